@@ -1104,6 +1104,39 @@ void set_column_family(http_context& ctx, routes& r, sharded<replica::database>&
         return rest_toppartitions_generic(db, std::move(req));
     });
 
+    cf::get_hot_partitions.set(r, [&db] (std::unique_ptr<http::request> req) -> future<json::json_return_type> {
+        api::req_param<unsigned> list_size(*req, "list_size", 10);
+        auto hot = co_await db::hot_partitions_tracker::gather(db, list_size.value);
+
+        auto to_record = [] (const db::hot_partitions_tracker::hot_partition& p) {
+            cf::hot_partition_record r;
+            r.keyspace = p.keyspace;
+            r.table = p.table;
+            r.partition = p.key;
+            r.count = p.count;
+            r.error = p.error;
+            return r;
+        };
+        cf::hot_partitions_results results;
+        for (auto& p : hot.reads) {
+            results.read.push(to_record(p));
+        }
+        for (auto& p : hot.writes) {
+            results.write.push(to_record(p));
+        }
+        for (auto& t : hot.tables) {
+            cf::hot_partitions_table_record r;
+            r.keyspace = t.keyspace;
+            r.table = t.table;
+            r.reads = t.reads;
+            r.writes = t.writes;
+            r.read_bytes = t.read_bytes;
+            r.write_bytes = t.write_bytes;
+            results.tables.push(r);
+        }
+        co_return results;
+    });
+
     cf::force_major_compaction.set(r, [&ctx, &db](std::unique_ptr<http::request> req) -> future<json::json_return_type> {
         if (!req->get_query_param("split_output").empty()) {
             fail(unimplemented::cause::API);
@@ -1271,6 +1304,7 @@ void unset_column_family(http_context& ctx, routes& r) {
     cf::get_sstables_for_key.unset(r);
     cf::toppartitions.unset(r);
     ss::toppartitions_generic.unset(r);
+    cf::get_hot_partitions.unset(r);
     cf::force_major_compaction.unset(r);
     ss::get_load.unset(r);
     ss::get_metrics_load.unset(r);
@@ -17,6 +17,10 @@
 #include "seastarx.hh"
 #include "backlog_controller_fwd.hh"
 
+namespace utils {
+struct estimated_histogram;
+}
+
 // Simple proportional controller to adjust shares for processes for which a backlog can be clearly
 // defined.
 //
@@ -146,4 +150,21 @@ class compaction_controller : public backlog_controller {
 
     // Updates the maximum output value for control points.
     void set_max_shares(float max_shares);
+
+    // Read amplification awareness.
+    //
+    // The backlog measures how much work compaction has left, but not how much reads suffer from
+    // it. When a read amplification target is configured, the normalized backlog is scaled by the
+    // ratio between the observed and the target number of sstables touched per read, capped at
+    // max_read_amplification_boost, so we consume the backlog faster while reads are hurting.
+    //
+    // The boost fades out as memtable flush pressure (0 at the dirty soft limit, 1 at the hard
+    // limit) grows: taking CPU away from flushes at that point would throttle writes instead.
+    static constexpr float max_read_amplification_boost = 4.0f;
+    static float read_amplification_boost(float observed, float target, float flush_pressure);
+
+    // Returns the given percentile of the values recorded into `h` since the
+    // `previous` bucket counts were taken, or 0 if fewer than `min_count` values
+    // were recorded in between.
+    static int64_t interval_percentile(const utils::estimated_histogram& h, const std::vector<int64_t>& previous, double perc, int64_t min_count);
 };
@@ -17,6 +17,10 @@
 
 class reader_permit;
 
+namespace utils {
+struct estimated_histogram;
+}
+
 namespace sstables {
 class sstable_set;
 class sstables_manager;
@@ -64,6 +68,8 @@ class compaction_group_view {
     virtual seastar::condition_variable& get_staging_done_condition() noexcept = 0;
     virtual dht::token_range get_token_range_after_split(const dht::token& t) const noexcept = 0;
     virtual int64_t get_sstables_repaired_at() const noexcept = 0;
+    // Distribution of the number of sstables touched by single-partition reads of the owning table.
+    virtual const utils::estimated_histogram& sstables_per_read_histogram() const noexcept = 0;
 };
 
 } // namespace compaction
@@ -25,6 +25,7 @@
 #include "utils/assert.hh"
 #include "utils/error_injection.hh"
 #include "utils/UUID_gen.hh"
+#include "utils/estimated_histogram.hh"
 #include "db/compaction_history_entry.hh"
 #include "db/system_keyspace.hh"
 #include "db/config.hh"
@@ -1115,7 +1116,7 @@ compaction_manager::compaction_manager(config cfg, abort_source& as, tasks::task
             // all strategies.
             return compaction_controller::normalization_factor;
         }
-        return b;
+        return b * update_read_amplification_boost();
     }))
     , _backlog_manager(_compaction_controller)
     , _early_abort_subscription(as.subscribe([this] () noexcept {
@@ -1176,9 +1177,49 @@ void compaction_manager::register_metrics() {
                        sm::description("Holds the sum of normalized compaction backlog for all tables in the system. Backlog is normalized by dividing backlog by shard's available memory.")),
         sm::make_counter("validation_errors", [this] { return _validation_errors; },
                        sm::description("Holds the number of encountered validation errors.")).set_skip_when_empty(),
+        sm::make_gauge("read_amplification", [this] { return _read_amplification; },
+                       sm::description("Holds the smoothed worst p99 of sstables touched per single-partition read across all tables. Only tracked when compaction_read_amplification_target is set.")),
+        sm::make_gauge("read_amplification_boost", [this] { return _read_amplification_boost; },
+                       sm::description("Holds the factor by which the normalized backlog is scaled due to read amplification exceeding its target.")),
     });
 }
 
+float compaction_manager::update_read_amplification_boost() {
+    auto target = read_amplification_target();
+    if (target <= 0) {
+        _sstables_per_read_snapshots.clear();
+        _read_amplification = 0.0f;
+        _read_amplification_boost = 1.0f;
+        return _read_amplification_boost;
+    }
+
+    // Percentiles over a controller interval with only a handful of reads are noise.
+    static constexpr int64_t min_reads_per_interval = 100;
+    // Weight of the latest interval in the smoothed read amplification.
+    static constexpr float smoothing_factor = 0.25f;
+
+    std::unordered_map<table_id, std::vector<int64_t>> snapshots;
+    int64_t worst = 0;
+    for (auto& [view, state] : _compaction_state) {
+        auto id = view->schema()->id();
+        // All compaction groups of a table share the table's histogram.
+        if (snapshots.contains(id)) {
+            continue;
+        }
+        const auto& h = view->sstables_per_read_histogram();
+        if (auto it = _sstables_per_read_snapshots.find(id); it != _sstables_per_read_snapshots.end() && it->second.size() == h.get_buckets().size()) {
+            worst = std::max(worst, compaction_controller::interval_percentile(h, it->second, 0.99, min_reads_per_interval));
+        }
+        snapshots.emplace(id, h.get_buckets());
+    }
+    _sstables_per_read_snapshots = std::move(snapshots);
+
+    _read_amplification += (float(worst) - _read_amplification) * smoothing_factor;
+    auto flush_pressure = _flush_pressure ? _flush_pressure() : 0.0f;
+    _read_amplification_boost = compaction_controller::read_amplification_boost(_read_amplification, target, flush_pressure);
+    return _read_amplification_boost;
+}
+
 void compaction_manager::enable() {
     if (_state == state::stopped) {
         // The manager is being (or has been) stopped, e.g. shutdown started
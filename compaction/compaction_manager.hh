@@ -84,6 +84,8 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
         utils::updateable_value<float> max_shares = utils::updateable_value<float>(0);
         utils::updateable_value<uint32_t> throughput_mb_per_sec = utils::updateable_value<uint32_t>(0);
         std::chrono::seconds flush_all_tables_before_major = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::days(1));
+        // Target p99 of sstables touched per single-partition read, 0 disables read amplification awareness.
+        utils::updateable_value<float> read_amplification_target = utils::updateable_value<float>(0);
     };
 
 public:
@@ -124,6 +126,18 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     seastar::metrics::metric_groups _metrics;
     double _last_backlog = 0.0f;
 
+    // Read amplification feedback for the compaction controller, see
+    // compaction_controller::read_amplification_boost().
+    //
+    // Per-table snapshot of the sstables-per-read histogram buckets, taken on the
+    // previous controller tick, so percentiles can be computed over the last interval.
+    std::unordered_map<table_id, std::vector<int64_t>> _sstables_per_read_snapshots;
+    // Smoothed worst p99 sstables per read across all tables.
+    float _read_amplification = 0.0f;
+    float _read_amplification_boost = 1.0f;
+    // Returns the memtable flush pressure, provided by the database.
+    std::function<float()> _flush_pressure;
+
     // Store sstables that are being compacted at the moment. That's needed to prevent
     // a sstable from being compacted twice.
     std::unordered_set<sstables::shared_sstable> _compacting_sstables;
@@ -192,6 +206,9 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     // Return the largest fan-in of currently running compactions
     unsigned current_compaction_fan_in_threshold() const;
 
+    // Samples per-table read amplification and returns the factor to scale the normalized backlog by.
+    float update_read_amplification_boost();
+
     // Return true if compaction can be initiated
     bool can_register_compaction(compaction::compaction_group_view& t, int weight, unsigned fan_in) const;
     // Register weight for a table. Do that only if can_register_weight()
@@ -309,6 +326,16 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
         return _cfg.flush_all_tables_before_major;
     }
 
+    float read_amplification_target() const noexcept {
+        return _cfg.read_amplification_target.get();
+    }
+
+    // Sets the source of memtable flush pressure, a value between 0 (at or below the dirty
+    // soft limit) and 1 (at the dirty hard limit). An empty function resets it.
+    void set_flush_pressure_source(std::function<float()> fn) noexcept {
+        _flush_pressure = std::move(fn);
+    }
+
     void register_metrics();
 
     // enable the compaction manager.
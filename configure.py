@@ -909,6 +909,7 @@ scylla_core = (['message/messaging_service.cc',
                 'replica/multishard_query.cc',
                 'replica/mutation_dump.cc',
                 'replica/querier.cc',
+                'replica/read_coalescer.cc',
                 'replica/logstor/segment_io.cc',
                 'replica/logstor/segment_manager.cc',
                 'replica/logstor/logstor.cc',
@@ -1116,6 +1117,7 @@ scylla_core = (['message/messaging_service.cc',
                 'service/migration_manager.cc',
                 'service/tablet_allocator.cc',
                 'service/storage_proxy.cc',
+                'service/coordinator_read_cache.cc',
                 'query_ranges_to_vnodes.cc',
                 'service/mapreduce_service.cc',
                 'service/paxos/proposal.cc',
@@ -1129,6 +1131,7 @@ scylla_core = (['message/messaging_service.cc',
                 'cql3/query_options.cc',
                 'cql3/user_types.cc',
                 'cql3/untyped_result_set.cc',
+                'cql3/selection/batched_aggregate.cc',
                 'cql3/selection/selectable.cc',
                 'cql3/selection/selection.cc',
                 'cql3/selection/selector.cc',
@@ -1709,6 +1712,7 @@ deps['test/boost/combined_tests'] += [
     'test/boost/commitlog_cleanup_test.cc',
     'test/boost/commitlog_raft_replay_test.cc',
     'test/boost/commitlog_test.cc',
+    'test/boost/coordinator_read_cache_test.cc',
     'test/boost/cql_auth_query_test.cc',
     'test/boost/cql_functions_test.cc',
     'test/boost/cql_query_group_test.cc',
@@ -1741,6 +1745,7 @@ deps['test/boost/combined_tests'] += [
     'test/boost/per_partition_rate_limit_test.cc',
     'test/boost/pluggable_test.cc',
     'test/boost/querier_cache_test.cc',
+    'test/boost/read_coalescer_test.cc',
     'test/boost/query_processor_test.cc',
     'test/boost/reader_concurrency_semaphore_test.cc',
     'test/boost/repair_test.cc',
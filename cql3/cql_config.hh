@@ -27,8 +27,10 @@ struct cql_config {
     twcs_restrictions twcs_restrictions;
     view_restrictions view_restrictions;
     utils::updateable_value<uint32_t> select_internal_page_size;
+    utils::updateable_value<uint32_t> secondary_index_base_read_concurrency;
     utils::updateable_value<db::tri_mode_restriction> strict_allow_filtering;
     utils::updateable_value<bool> enable_parallelized_aggregation;
+    utils::updateable_value<bool> migrate_single_partition_reads;
     utils::updateable_value<uint32_t> batch_size_warn_threshold_in_kb;
     utils::updateable_value<uint32_t> batch_size_fail_threshold_in_kb;
     utils::updateable_value<bool> restrict_future_timestamp;
@@ -40,8 +42,10 @@ struct cql_config {
         , twcs_restrictions(cfg)
         , view_restrictions(cfg)
         , select_internal_page_size(cfg.select_internal_page_size)
+        , secondary_index_base_read_concurrency(cfg.secondary_index_base_read_concurrency)
         , strict_allow_filtering(cfg.strict_allow_filtering)
         , enable_parallelized_aggregation(cfg.enable_parallelized_aggregation)
+        , migrate_single_partition_reads(cfg.cql_migrate_single_partition_reads)
         , batch_size_warn_threshold_in_kb(cfg.batch_size_warn_threshold_in_kb)
         , batch_size_fail_threshold_in_kb(cfg.batch_size_fail_threshold_in_kb)
         , restrict_future_timestamp(cfg.restrict_future_timestamp)
@@ -54,8 +58,10 @@ struct cql_config {
         , twcs_restrictions(twcs_restrictions::default_tag{})
         , view_restrictions(view_restrictions::default_tag{})
         , select_internal_page_size(10000)
+        , secondary_index_base_read_concurrency(4096)
         , strict_allow_filtering(db::tri_mode_restriction(db::tri_mode_restriction_t::mode::WARN))
         , enable_parallelized_aggregation(true)
+        , migrate_single_partition_reads(false)
         , batch_size_warn_threshold_in_kb(128)
         , batch_size_fail_threshold_in_kb(1024)
         , restrict_future_timestamp(true)
@@ -162,11 +162,6 @@ narrow(WideT acc) {
     return ret;
 }
 
-// We need a wider accumulator for sum and average,
-// since summing the inputs can overflow the input type
-template <typename T>
-using accumulator_for = std::conditional_t<std::is_integral_v<T>, utils::multiprecision_int, T>;
-
 template <typename Type>
 static
 shared_ptr<aggregate_function>
@@ -10,7 +10,10 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "aggregate_function.hh"
+#include "utils/multiprecision_int.hh"
 
 namespace cql3 {
 namespace functions {
@@ -36,6 +39,11 @@ make_min_function(data_type io_type);
 /// count(col) function for the specified type
 shared_ptr<aggregate_function> make_count_function(data_type input_type);
 
+/// The type sum() and avg() accumulate values of type T in. Integers are
+/// accumulated in a wider type, since summing them can overflow T.
+template <typename T>
+using accumulator_for = std::conditional_t<std::is_integral_v<T>, utils::multiprecision_int, T>;
+
 }
 }
 }
@@ -23,6 +23,7 @@
 #include "service/raft/raft_group0_client.hh"
 #include "service/storage_service.hh"
 #include "service/strong_consistency/coordinator.hh"
+#include "replica/database.hh"
 #include "cql3/CqlParser.hpp"
 #include "cql3/statements/batch_statement.hh"
 #include "cql3/statements/modification_statement.hh"
@@ -384,6 +385,12 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
                             _cql_stats.secondary_index_rows_read,
                             sm::description("Counts the total number of rows read during CQL requests performed using secondary indexes.")).set_skip_when_empty(),
 
+                    // secondary_index_covered_reads total count is also included in secondary_index_reads
+                    sm::make_counter(
+                            "secondary_index_covered_reads",
+                            _cql_stats.secondary_index_covered_reads,
+                            sm::description("Counts the total number of CQL read requests answered from a secondary index alone, without reading the base table.")).set_skip_when_empty(),
+
                     // read requests that required ALLOW FILTERING
                     sm::make_counter(
                             "filtered_read_requests",
@@ -1287,12 +1294,37 @@ future<> query_processor::query_internal(
 
 shared_ptr<cql_transport::messages::result_message> query_processor::bounce_to_shard(unsigned shard, cql3::computed_function_values cached_fn_calls, bool track) {
     if (track) {
-        _proxy.get_stats().replica_cross_shard_ops++;
+        _proxy.account_cross_shard_op(shard);
     }
     const auto my_host_id = _proxy.get_token_metadata_ptr()->get_topology().my_host_id();
     return ::make_shared<cql_transport::messages::result_message::bounce>(my_host_id, shard, std::move(cached_fn_calls));
 }
 
+std::optional<shard_id> query_processor::shard_for_read_migration(const schema& s, dht::token token, const service::client_state& client_state) const {
+    // Migrate only once, from the shard the client is connected to.
+    if (!_cql_config.migrate_single_partition_reads() || client_state.is_internal() || client_state.get_original_shard() != this_shard_id()) {
+        return std::nullopt;
+    }
+    auto shard = s.table().shard_for_reads(token);
+    if (shard == this_shard_id()) {
+        return std::nullopt;
+    }
+    // The read would be coordinated by another node anyway, nothing to gain.
+    auto erm = s.table().get_effective_replication_map();
+    if (!std::ranges::contains(erm->get_natural_replicas(token), erm->get_topology().my_host_id())) {
+        return std::nullopt;
+    }
+    return shard;
+}
+
+shared_ptr<cql_transport::messages::result_message> query_processor::migrate_read_to_shard(unsigned shard, cql3::computed_function_values cached_fn_calls) {
+    _proxy.account_cross_shard_op(shard);
+    const auto my_host_id = _proxy.get_token_metadata_ptr()->get_topology().my_host_id();
+    auto msg = ::make_shared<cql_transport::messages::result_message::bounce>(my_host_id, shard, std::move(cached_fn_calls));
+    msg->set_read_migration();
+    return msg;
+}
+
 shared_ptr<cql_transport::messages::result_message> query_processor::bounce_to_node(
         locator::tablet_replica replica,
         cql3::computed_function_values cached_fn_calls,
@@ -33,6 +33,7 @@
 #include "utils/rolling_max_tracker.hh"
 #include "service/raft/raft_group0_client.hh"
 #include "types/types.hh"
+#include "dht/token.hh"
 #include "db/consistency_level_type.hh"
 #include "db/config.hh"
 #include "utils/enum_option.hh"
@@ -523,6 +524,13 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
     friend class migration_subscriber;
 
     shared_ptr<cql_transport::messages::result_message> bounce_to_shard(unsigned shard, cql3::computed_function_values cached_fn_calls, bool track = true);
+    // Returns the shard to which a client's single-partition read of `token`
+    // should be migrated, if cql_migrate_single_partition_reads is enabled
+    // and this node is a replica of the token owned by another shard.
+    std::optional<shard_id> shard_for_read_migration(const schema& s, dht::token token, const service::client_state& client_state) const;
+    // Like bounce_to_shard(), for a read migrated to the shard returned by
+    // shard_for_read_migration().
+    shared_ptr<cql_transport::messages::result_message> migrate_read_to_shard(unsigned shard, cql3::computed_function_values cached_fn_calls);
     shared_ptr<cql_transport::messages::result_message> bounce_to_node(
             locator::tablet_replica replica,
             cql3::computed_function_values cached_fn_calls,
@@ -1685,6 +1685,44 @@ dht::partition_range_vector partition_ranges_from_singles(
     return ranges;
 }
 
+/// Returns the right-hand sides of \p preds, ordered by column position, if they are plain single-column EQs on
+/// distinct columns of the given kind covering positions 0 to column_count-1.  Such restrictions describe a single key
+/// (prefix), whose values can be evaluated directly on every execution instead of being solved into value_sets.
+std::optional<std::vector<expression>> eq_operands(
+        const std::vector<predicate>& preds, column_kind kind, size_t column_count) {
+    if (preds.size() != column_count) {
+        return std::nullopt;
+    }
+    std::vector<std::optional<expression>> operands(column_count);
+    for (const auto& p : preds) {
+        if (!p.equality || p.is_subscript || p.is_multi_column || !p.solve_for) {
+            return std::nullopt;
+        }
+        const auto col = require_on_single_column(p);
+        if (col->kind != kind || col->position() >= column_count || operands[col->position()]) {
+            return std::nullopt;
+        }
+        operands[col->position()] = as<binary_operator>(p.filter).rhs;
+    }
+    return operands | std::views::transform([] (std::optional<expression>& e) { return std::move(*e); })
+            | std::ranges::to<std::vector>();
+}
+
+/// Evaluates operands returned by eq_operands().  Returns nullopt if any of them is NULL, since no key equals NULL.
+std::optional<std::vector<managed_bytes>> evaluate_eq_operands(
+        const std::vector<expression>& operands, const query_options& options) {
+    std::vector<managed_bytes> values;
+    values.reserve(operands.size());
+    for (const auto& e : operands) {
+        auto val = evaluate(e, options).to_managed_bytes_opt();
+        if (!val) {
+            return std::nullopt;
+        }
+        values.push_back(std::move(*val));
+    }
+    return values;
+}
+
 /// Computes partition-key ranges from EQ restrictions on each partition column.  Returns a single singleton range if
 /// the EQ restrictions are not mutually conflicting.  Otherwise, returns an empty vector.
 dht::partition_range_vector partition_ranges_from_EQs(
@@ -1721,6 +1759,16 @@ statement_restrictions::build_partition_key_ranges_fn() const {
         },
         [&] (const single_column_partition_range_restrictions& r) -> get_partition_key_ranges_fn_t {
             if (_partition_range_is_simple) {
+                if (auto operands = eq_operands(r.per_column_restrictions, column_kind::partition_key, _schema->partition_key_size())) {
+                    // Single-partition lookup, e.g. a prepared `WHERE pk = ?`: build the key straight from the values.
+                    return [operands = std::move(*operands), this] (const query_options& options) -> dht::partition_range_vector {
+                        auto pk = evaluate_eq_operands(operands, options);
+                        if (!pk) {
+                            return {};
+                        }
+                        return {range_from_bytes(*_schema, *pk)};
+                    };
+                }
                 return [&] (const query_options& options) {
                     // Special case to avoid extra allocations required for a Cartesian product.
                     return partition_ranges_from_EQs(r.per_column_restrictions, options, *_schema);
@@ -2347,6 +2395,15 @@ statement_restrictions::build_get_clustering_bounds_fn() const {
         }
         return build_get_multi_column_clustering_bounds_fn(_schema, _clustering_prefix_restrictions,
             all_natural, all_reverse);
+        } else if (auto operands = eq_operands(_clustering_prefix_restrictions, column_kind::clustering_key, _clustering_prefix_restrictions.size())) {
+            // Clustering-key prefix equality, e.g. a prepared `WHERE pk = ? AND ck = ?`: a single singular range.
+            return [operands = std::move(*operands)] (const query_options& options) -> std::vector<query::clustering_range> {
+                auto prefix = evaluate_eq_operands(operands, options);
+                if (!prefix) {
+                    return {};
+                }
+                return {query::clustering_range::make_singular(clustering_key_prefix::from_exploded(*prefix))};
+            };
         } else {
             return [&] (const query_options& options) -> std::vector<query::clustering_range> {
                 return get_single_column_clustering_bounds(options, *_schema, _clustering_prefix_restrictions);
@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+
+#include "cql3/selection/batched_aggregate.hh"
+#include "cql3/selection/selection.hh"
+#include "cql3/functions/aggregate_fcts.hh"
+#include "cql3/functions/aggregate_function.hh"
+#include "types/types.hh"
+#include "types/tuple.hh"
+#include "utils/fragment_range.hh"
+#include "utils/multiprecision_int.hh"
+
+namespace cql3::selection {
+
+namespace {
+
+// Large enough to amortize folding into the serialized state, small enough
+// for a batch of the widest values to stay in L1.
+constexpr size_t batch_size = 256;
+
+using functions::aggregate_fcts::accumulator_for;
+
+template <typename T>
+class value_batch {
+    std::array<T, batch_size> _values;
+    size_t _size = 0;
+public:
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+    bool full() const noexcept {
+        return _size == batch_size;
+    }
+    void push_back(T v) noexcept {
+        _values[_size++] = v;
+    }
+    std::span<const T> values() const noexcept {
+        return {_values.data(), _size};
+    }
+    void clear() noexcept {
+        _size = 0;
+    }
+};
+
+template <typename T>
+T decode(managed_bytes_view v) {
+    if constexpr (std::is_floating_point_v<T>) {
+        using bits = std::conditional_t<sizeof(T) == sizeof(int32_t), int32_t, int64_t>;
+        return std::bit_cast<T>(read_simple_exactly<bits>(v));
+    } else {
+        return read_simple_exactly<T>(v);
+    }
+}
+
+// The sum of a batch of integers. Values of up to 32 bits cannot overflow an
+// int64_t in a batch. 64-bit values are summed as separate high and low 32-bit
+// halves, which cannot overflow either.
+template <std::integral T>
+utils::multiprecision_int sum_of(std::span<const T> values) {
+    if constexpr (sizeof(T) < sizeof(int64_t)) {
+        int64_t sum = 0;
+        for (T v : values) {
+            sum += v;
+        }
+        return utils::multiprecision_int(sum);
+    } else {
+        int64_t high = 0;
+        uint64_t low = 0;
+        for (T v : values) {
+            high += v >> 32;
+            low += uint32_t(v);
+        }
+        return (utils::multiprecision_int(high) << 32) + utils::multiprecision_int(low);
+    }
+}
+
+// Floating-point addition is not associative, so the values are added to the
+// accumulator one by one, in row order.
+template <std::floating_point T>
+T sum_of(T acc, std::span<const T> values) {
+    for (T v : values) {
+        acc += v;
+    }
+    return acc;
+}
+
+template <typename T>
+accumulator_for<T> add_batch(accumulator_for<T> acc, std::span<const T> values) {
+    if constexpr (std::is_integral_v<T>) {
+        return acc + sum_of(values);
+    } else {
+        return sum_of(acc, values);
+    }
+}
+
+template <bool Max, std::integral T>
+T extremum_of(std::span<const T> values) {
+    T ret = values.front();
+    for (T v : values) {
+        ret = Max ? std::max(ret, v) : std::min(ret, v);
+    }
+    return ret;
+}
+
+template <typename T>
+T get_state(const raw_value& state) {
+    return state.view().deserialize<T>(*data_type_for<T>());
+}
+
+void set_state(raw_value& state, const data_value& v) {
+    state = raw_value::make_value(v.serialize_nonnull());
+}
+
+// A null state stays null, like it does with the aggregation functions.
+void add_to_count(raw_value& state, int64_t n) {
+    if (n && !state.is_null()) {
+        set_state(state, get_state<int64_t>(state) + n);
+    }
+}
+
+class count_rows_aggregate final : public batched_aggregate {
+    int64_t _rows = 0;
+public:
+    virtual bool add(const std::vector<managed_bytes_opt>&, raw_value&) override {
+        ++_rows;
+        return true;
+    }
+    virtual void flush(raw_value& state) override {
+        add_to_count(state, std::exchange(_rows, 0));
+    }
+    virtual void clear() noexcept override {
+        _rows = 0;
+    }
+};
+
+class count_aggregate final : public batched_aggregate {
+    uint32_t _column;
+    int64_t _values = 0;
+public:
+    explicit count_aggregate(uint32_t column) : _column(column) { }
+    virtual bool add(const std::vector<managed_bytes_opt>& row, raw_value&) override {
+        _values += bool(row[_column]);
+        return true;
+    }
+    virtual void flush(raw_value& state) override {
+        add_to_count(state, std::exchange(_values, 0));
+    }
+    virtual void clear() noexcept override {
+        _values = 0;
+    }
+};
+
+// Batches the non-null values of a column. Subclasses fold them into the state.
+template <typename T>
+class column_aggregate : public batched_aggregate {
+    uint32_t _column;
+protected:
+    value_batch<T> _batch;
+public:
+    explicit column_aggregate(uint32_t column) : _column(column) { }
+    virtual bool add(const std::vector<managed_bytes_opt>& row, raw_value& state) override {
+        const auto& cell = row[_column];
+        if (!cell) {
+            return true;
+        }
+        if (cell->size() != sizeof(T)) {
+            return false;
+        }
+        _batch.push_back(decode<T>(managed_bytes_view(*cell)));
+        if (_batch.full()) {
+            flush(state);
+        }
+        return true;
+    }
+    virtual void clear() noexcept override {
+        _batch.clear();
+    }
+};
+
+template <typename T>
+class sum_aggregate final : public column_aggregate<T> {
+public:
+    using column_aggregate<T>::column_aggregate;
+    virtual void flush(raw_value& state) override {
+        auto& batch = this->_batch;
+        if (!batch.empty() && !state.is_null()) {
+            set_state(state, add_batch<T>(get_state<accumulator_for<T>>(state), batch.values()));
+        }
+        batch.clear();
+    }
+};
+
+template <typename T>
+class avg_aggregate final : public column_aggregate<T> {
+    data_type _state_type;
+public:
+    avg_aggregate(uint32_t column, data_type state_type)
+        : column_aggregate<T>(column), _state_type(std::move(state_type)) { }
+    virtual void flush(raw_value& state) override {
+        auto& batch = this->_batch;
+        if (!batch.empty() && !state.is_null()) {
+            // The state is a (sum, count) tuple.
+            auto acc = state.view().deserialize<tuple_type_impl::native_type>(*_state_type);
+            auto sum = add_batch<T>(value_cast<accumulator_for<T>>(acc[0]), batch.values());
+            auto count = value_cast<int64_t>(acc[1]) + int64_t(batch.values().size());
+            acc[0] = data_value(std::move(sum));
+            acc[1] = data_value(count);
+            state = raw_value::make_value(make_tuple_value(_state_type, std::move(acc)).serialize());
+        }
+        batch.clear();
+    }
+};
+
+// min() and max() of integers. Those of floating-point values aren't batched,
+// as NaN and -0 are ordered differently than by the built-in comparison.
+template <std::integral T, bool Max>
+class extremum_aggregate final : public column_aggregate<T> {
+public:
+    using column_aggregate<T>::column_aggregate;
+    virtual void flush(raw_value& state) override {
+        auto& batch = this->_batch;
+        if (batch.empty()) {
+            return;
+        }
+        const T e = extremum_of<Max>(batch.values());
+        batch.clear();
+        if (state.is_null()) {
+            set_state(state, data_value(e));
+        } else if (state.is_empty_value()) {
+            // An empty value, aggregated row by row, sorts before any other.
+            if constexpr (Max) {
+                set_state(state, data_value(e));
+            }
+        } else {
+            const T s = get_state<T>(state);
+            set_state(state, data_value(Max ? std::max(s, e) : std::min(s, e)));
+        }
+    }
+};
+
+}
+
+std::unique_ptr<batched_aggregate> batched_aggregate::make(const expr::function_call& fc, const selection& sel) {
+    using functions::function_name;
+
+    auto* fn = std::get_if<shared_ptr<functions::function>>(&fc.func);
+    if (!fn || !(*fn)->is_aggregate() || !(*fn)->is_native()) {
+        return nullptr;
+    }
+    const auto& name = (*fn)->name();
+    if (name == function_name::native_function(functions::aggregate_fcts::COUNT_ROWS_FUNCTION_NAME)) {
+        return fc.args.empty() ? std::make_unique<count_rows_aggregate>() : nullptr;
+    }
+    if (fc.args.size() != 1) {
+        return nullptr;
+    }
+    auto* col = expr::as_if<expr::column_value>(&fc.args[0]);
+    if (!col || !(col->col->is_regular() || col->col->is_static())) {
+        return nullptr;
+    }
+    const auto index = sel.index_of(*col->col);
+    if (index < 0) {
+        return nullptr;
+    }
+    if (name == function_name::native_function("count")) {
+        return std::make_unique<count_aggregate>(index);
+    }
+
+    const auto& agg = dynamic_pointer_cast<functions::aggregate_function>(*fn)->get_aggregate();
+    const abstract_type& type = col->col->type->without_reversed();
+    if (agg.argument_types.size() != 1 || &type != agg.argument_types[0].get()) {
+        return nullptr;
+    }
+    auto make_for = [&] <typename T> () -> std::unique_ptr<batched_aggregate> {
+        if (name == function_name::native_function("sum")) {
+            return std::make_unique<sum_aggregate<T>>(index);
+        }
+        if (name == function_name::native_function("avg")) {
+            return std::make_unique<avg_aggregate<T>>(index, agg.state_type);
+        }
+        if constexpr (std::is_integral_v<T>) {
+            if (name == function_name::native_function("min")) {
+                return std::make_unique<extremum_aggregate<T, false>>(index);
+            }
+            if (name == function_name::native_function("max")) {
+                return std::make_unique<extremum_aggregate<T, true>>(index);
+            }
+        }
+        return nullptr;
+    };
+    if (&type == byte_type.get()) {
+        return make_for.operator()<int8_t>();
+    } else if (&type == short_type.get()) {
+        return make_for.operator()<int16_t>();
+    } else if (&type == int32_type.get()) {
+        return make_for.operator()<int32_t>();
+    } else if (&type == long_type.get()) {
+        return make_for.operator()<int64_t>();
+    } else if (&type == float_type.get()) {
+        return make_for.operator()<float>();
+    } else if (&type == double_type.get()) {
+        return make_for.operator()<double>();
+    }
+    return nullptr;
+}
+
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cql3/expr/expression.hh"
+#include "cql3/values.hh"
+#include "utils/managed_bytes.hh"
+
+namespace cql3::selection {
+
+class selection;
+
+// Computes a native aggregate - countRows(), or count, sum, avg, min or max of
+// a fixed-width numeric column - over batches of rows. The values of the column
+// are decoded into a typed array, which is reduced by a tight loop the compiler
+// can vectorize, and folded into the serialized state once per batch. This
+// saves calling the aggregation function, with its serialized arguments and
+// state, on every row.
+//
+// The result is the same as the one of the aggregation function. Sums and
+// averages of floating-point values are accumulated in row order, so they
+// round the same.
+class batched_aggregate {
+public:
+    virtual ~batched_aggregate() = default;
+
+    // Adds the row's value of the aggregated column to the batch, folding the
+    // batch into the state when it is full. Returns false if the value cannot
+    // be batched, e.g. if it is an empty value; the caller must then flush()
+    // the batch and aggregate the row with the aggregation function.
+    virtual bool add(const std::vector<managed_bytes_opt>& static_and_regular_columns, raw_value& state) = 0;
+
+    // Folds the values added since the last fold into the state.
+    virtual void flush(raw_value& state) = 0;
+
+    // Drops the values added since the last fold.
+    virtual void clear() noexcept = 0;
+
+    // Returns an implementation of the aggregate function call fc, or nullptr
+    // if it has none. fc must be an aggregate call of a selector of sel.
+    static std::unique_ptr<batched_aggregate> make(const expr::function_call& fc, const selection& sel);
+};
+
+}
@@ -10,6 +10,7 @@
 
 #include "cql3/selection/selection.hh"
 #include "cql3/selection/raw_selector.hh"
+#include "cql3/selection/batched_aggregate.hh"
 #include "cql3/result_set.hh"
 #include "cql3/query_options.hh"
 #include "cql3/restrictions/statement_restrictions.hh"
@@ -389,8 +390,18 @@ class selection_with_processing : public selection {
     private:
         const selection_with_processing& _sel;
         std::vector<raw_value> _temporaries;
+        // Indexed by temporary; a null entry is aggregated row by row.
+        std::vector<std::unique_ptr<batched_aggregate>> _batched;
         bool _requires_thread;
         std::uint64_t _input_row_count;
+    private:
+        void flush_batched() {
+            for (size_t i = 0; i != _batched.size(); ++i) {
+                if (_batched[i]) {
+                    _batched[i]->flush(_temporaries[i]);
+                }
+            }
+        }
     public:
         explicit selectors_with_processing(const selection_with_processing& sel)
             : _sel(sel)
@@ -401,13 +412,31 @@ class selection_with_processing : public selection {
                 });
              }))
             , _input_row_count(0)
-        { }
+        {
+            // When every selector is an aggregate call, split_aggregation()
+            // allocated the i-th temporary to the i-th selector.
+            auto is_aggregate_call = [] (const expr::expression& e) {
+                auto fc = expr::as_if<expr::function_call>(&e);
+                return fc && std::get<shared_ptr<functions::function>>(fc->func)->is_aggregate();
+            };
+            if (!_sel._inner_loop.empty() && std::ranges::all_of(_sel._selectors, is_aggregate_call)) {
+                _batched.reserve(_sel._selectors.size());
+                for (auto& e : _sel._selectors) {
+                    _batched.push_back(batched_aggregate::make(expr::as<expr::function_call>(e), _sel));
+                }
+            }
+        }
 
         virtual bool requires_thread() const override {
             return _requires_thread;
         }
 
         virtual void reset() override {
+            for (auto& b : _batched) {
+                if (b) {
+                    b->clear();
+                }
+            }
             _temporaries = _sel._initial_values_for_temporaries;
             _input_row_count = 0;
         }
@@ -438,6 +467,7 @@ class selection_with_processing : public selection {
         }
 
         virtual std::vector<managed_bytes_opt> get_output_row() override {
+            flush_batched();
             std::vector<managed_bytes_opt> output_row;
             output_row.reserve(_sel._outer_loop.size());
             auto inputs = expr::evaluation_inputs{
@@ -470,6 +500,12 @@ class selection_with_processing : public selection {
                     .collection_element_metadata = rs._collection_element_metadata,
             };
             for (size_t i = 0; i != _sel._inner_loop.size(); ++i) {
+                if (i < _batched.size() && _batched[i]) {
+                    if (_batched[i]->add(rs.current, _temporaries[i])) {
+                        continue;
+                    }
+                    _batched[i]->flush(_temporaries[i]);
+                }
                 _temporaries[i] = expr::evaluate(_sel._inner_loop[i], inputs);
             }
             ++_input_row_count;
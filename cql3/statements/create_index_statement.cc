@@ -41,6 +41,7 @@
 #include "tombstone_gc_extension.hh"
 #include "index/secondary_index.hh"
 
+#include <fmt/ranges.h>
 #include <stdexcept>
 
 namespace cql3 {
@@ -295,6 +296,17 @@ view_ptr create_index_statement::create_view_for_index(const schema_ptr schema,
         }
     }
 
+    // A covering index stores its included columns, so that queries selecting
+    // only them, the base primary key and the indexed column can be answered
+    // from the view alone.
+    for (const auto& name : secondary_index::included_columns(im.options())) {
+        const auto* cdef = schema->get_column_definition(to_bytes(name));
+        if (!cdef) {
+            throw exceptions::invalid_request_exception(format("No column definition found for included column {}", name));
+        }
+        builder.with_column(cdef->name(), cdef->type);
+    }
+
     if (index_target->is_primary_key()) {
         for (auto& def : schema->regular_columns()) {
             db::view::create_virtual_column(builder, def.name(), def.type);
@@ -548,6 +560,10 @@ create_index_statement::validate_while_executing(data_dictionary::database db, l
         }
     }
 
+    if (_idx_properties->get_raw_options().contains(db::index::secondary_index::included_columns_option_name)) {
+        validate_included_columns(*schema, targets, secondary_index::included_columns(_idx_properties->get_raw_options()));
+    }
+
     if (db.existing_index_names(keyspace()).contains(_index_name)) {
         if (!_if_not_exists) {
             throw exceptions::invalid_request_exception("Index already exists");
@@ -725,6 +741,42 @@ void create_index_statement::validate_targets_for_multi_column_index(std::vector
     }
 }
 
+void create_index_statement::validate_included_columns(const schema& schema, const std::vector<::shared_ptr<index_target>>& targets,
+        const std::vector<sstring>& included) const
+{
+    const auto& option_name = db::index::secondary_index::included_columns_option_name;
+    const column_definition* target = nullptr;
+    if (!_idx_properties->custom_class && targets.size() == 1 && targets.front()->type == index_target::target_type::regular_values) {
+        if (auto* ident = std::get_if<index_target::single_column>(&targets.front()->value)) {
+            target = schema.get_column_definition((*ident)->name());
+        }
+    }
+    if (!target || !target->is_regular()) {
+        throw exceptions::invalid_request_exception(
+                format("Option '{}' is only supported by global indexes on a regular column", option_name));
+    }
+    if (included.empty()) {
+        throw exceptions::invalid_request_exception(format("Option '{}' must list at least one column", option_name));
+    }
+    std::unordered_set<sstring> seen;
+    for (const auto& name : included) {
+        const auto* cdef = schema.get_column_definition(to_bytes(name));
+        if (!cdef) {
+            throw exceptions::invalid_request_exception(format("No column definition found for included column {}", name));
+        }
+        if (!cdef->is_regular()) {
+            throw exceptions::invalid_request_exception(
+                    format("Cannot include column {}: only regular columns can be included in an index", name));
+        }
+        if (cdef == target) {
+            throw exceptions::invalid_request_exception(format("Cannot include the indexed column {}", name));
+        }
+        if (!seen.insert(name).second) {
+            throw exceptions::invalid_request_exception(format("Duplicate included column {}", name));
+        }
+    }
+}
+
 std::pair<std::optional<create_index_statement::base_schema_with_new_index>, cql3::cql_warnings_vec>
 create_index_statement::build_index_schema(data_dictionary::database db, locator::token_metadata_ptr tmptr) const {
     auto [targets, warnings] = validate_while_executing(db, tmptr);
@@ -748,6 +800,10 @@ create_index_statement::build_index_schema(data_dictionary::database db, locator
         kind = index_metadata_kind::custom;
     } else {
         kind = schema->is_compound() ? index_metadata_kind::composites : index_metadata_kind::keys;
+        auto included = secondary_index::included_columns(_idx_properties->get_raw_options());
+        if (!included.empty()) {
+            index_options.emplace(db::index::secondary_index::included_columns_option_name, fmt::to_string(fmt::join(included, ", ")));
+        }
     }
     auto index = make_index_metadata(targets, accepted_name, kind, index_options);
     auto existing_index = schema->find_index_noname(index);
@@ -33,10 +33,13 @@ void index_specific_prop_defs::validate() const {
         throw exceptions::invalid_request_exception("CUSTOM index requires specifying the index class");
     }
     
-    if (!custom_class && !_properties.empty()) {
+    auto options = get_raw_options();
+    // The only option a non-CUSTOM index takes is the list of columns it
+    // includes; it is validated against the base schema when the index is created.
+    if (!custom_class && !_properties.empty()
+            && !(options.size() == 1 && options.contains(db::index::secondary_index::included_columns_option_name))) {
         throw exceptions::invalid_request_exception("Cannot specify options for a non-CUSTOM index");
     }
-    auto options = get_raw_options();
     check_system_option_specified(options, db::index::secondary_index::custom_class_option_name);
     check_system_option_specified(options, db::index::secondary_index::index_version_option_name);
 
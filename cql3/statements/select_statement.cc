@@ -40,8 +40,10 @@
 #include "validation.hh"
 #include "db/system_keyspace.hh"
 #include "exceptions/unrecognized_entity_exception.hh"
+#include <deque>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <variant>
 #include <seastar/core/shared_ptr.hh>
 #include "query/query-result-reader.hh"
@@ -356,6 +358,51 @@ select_statement::make_partition_slice(const query_options& options) const
         std::move(static_columns), std::move(regular_columns), _opts, nullptr, per_partition_limit);
 }
 
+// Extracts the single-column restrictions on clustering key columns from the
+// per-row filter, in a form replicas can evaluate on the serialized clustering
+// key. Anything else is left to the coordinator-side filter alone.
+static query::clustering_filter make_clustering_filter(const expr::expression& row_filter, const query_options& options) {
+    using op = query::clustering_column_restriction::op;
+    query::clustering_filter filter;
+    for (const expr::expression& factor : expr::boolean_factors(row_filter)) {
+        auto binop = expr::as_if<expr::binary_operator>(&factor);
+        if (!binop || binop->order != expr::comparison_order::cql) {
+            continue;
+        }
+        auto col = expr::as_if<expr::column_value>(&binop->lhs);
+        if (!col || !col->col->is_clustering_key()) {
+            continue;
+        }
+        op oper;
+        switch (binop->op) {
+        case expr::oper_t::EQ:
+        case expr::oper_t::IN: oper = op::eq; break;
+        case expr::oper_t::LT: oper = op::lt; break;
+        case expr::oper_t::LTE: oper = op::lte; break;
+        case expr::oper_t::GT: oper = op::gt; break;
+        case expr::oper_t::GTE: oper = op::gte; break;
+        default: continue;
+        }
+        auto rhs = expr::evaluate(binop->rhs, options);
+        if (rhs.is_null()) {
+            continue;
+        }
+        std::vector<bytes> values;
+        if (binop->op == expr::oper_t::IN) {
+            for (auto& v : expr::get_list_elements(rhs)) {
+                if (v) {
+                    values.push_back(to_bytes(*v));
+                }
+            }
+        } else {
+            values.push_back(std::move(rhs).to_bytes());
+        }
+        filter.push_back(query::clustering_column_restriction{col->col->component_index(), oper, std::move(values)});
+    }
+    std::ranges::stable_sort(filter, std::less<>(), &query::clustering_column_restriction::column);
+    return filter;
+}
+
 uint64_t select_statement::get_limit(const query_options& options, const std::optional<expr::expression>& limit, bool is_per_partition_limit) const
 {
     const auto& unset_guard = is_per_partition_limit ? _per_partition_limit_unset_guard : _limit_unset_guard;
@@ -451,6 +498,9 @@ select_statement::do_execute(query_processor& qp,
     _stats.select_partition_range_scan_no_bypass_cache += _range_scan_no_bypass_cache;
 
     auto slice = make_partition_slice(options);
+    if (needs_post_filtering() && qp.db().features().clustering_filter_pushdown) {
+        slice.set_clustering_filter(make_clustering_filter(_restrictions->get_clustering_row_level_filter(), options));
+    }
     auto max_result_size = qp.proxy().get_max_result_size(slice);
     auto command = ::make_lw_shared<query::read_command>(
             _query_schema->id(),
@@ -526,6 +576,13 @@ select_statement::do_execute(query_processor& qp,
                     qp.bounce_to_shard(cas_shard->shard(), std::move(const_cast<cql3::query_options&>(options).take_cached_pk_function_calls()))
                 );
         }
+    } else if (key_ranges.size() == 1 && query::is_single_partition(key_ranges.front())) {
+        const auto token = key_ranges[0].start()->value().as_decorated_key().token();
+        if (auto shard = qp.shard_for_read_migration(*_schema, token, state.get_client_state())) {
+            return make_ready_future<shared_ptr<cql_transport::messages::result_message>>(
+                    qp.migrate_read_to_shard(*shard, std::move(const_cast<cql3::query_options&>(options).take_cached_pk_function_calls()))
+                );
+        }
     }
 
     auto f = make_ready_future<shared_ptr<cql_transport::messages::result_message>>();
@@ -744,6 +801,7 @@ view_indexed_table_select_statement::do_execute_base_query(
     }
 
     const bool is_paged = bool(paging_state);
+    const size_t max_concurrency = std::max<size_t>(qp.get_cql_config().secondary_index_base_read_concurrency(), 1);
     base_query_state query_state{cmd->get_row_limit() * queried_ranges_count, std::move(ranges_to_vnodes)};
     {
         auto& merger = query_state.merger;
@@ -786,8 +844,8 @@ view_indexed_table_select_statement::do_execute_base_query(
                     command->slice.set_range(*_schema, base_pk, row_ranges);
                 }
             }
-            if (previous_result_size < query::result_memory_limiter::maximum_result_size && concurrency < max_base_table_query_concurrency) {
-                concurrency *= 2;
+            if (previous_result_size < query::result_memory_limiter::maximum_result_size) {
+                concurrency = std::min(concurrency * 2, max_concurrency);
             }
             coordinator_result<service::storage_proxy::coordinator_query_result> rqr = co_await qp.proxy().query_result(_schema, command, std::move(prange), options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
             if (!rqr.has_value()) {
@@ -834,52 +892,102 @@ view_indexed_table_select_statement::do_execute_base_query(
     query::result_merger merger(cmd->get_row_limit(), query::max_partitions);
     std::vector<primary_key> keys = std::move(primary_keys);
     std::vector<primary_key>::iterator key_it(keys.begin());
-    size_t previous_result_size = 0;
-    size_t next_iteration_size = 0;
 
-    const bool is_paged = bool(paging_state);
-    while (key_it != keys.end()) {
-        // Starting with 1 key, we check if the result was a short read, and if not,
-        // we continue exponentially, asking for 2x more key than before
-        auto already_done = std::distance(keys.begin(), key_it);
-        // If the previous result already provided 1MB worth of data,
-        // stop increasing the number of fetched partitions
-        if (previous_result_size < query::result_memory_limiter::maximum_result_size) {
-            next_iteration_size = already_done + 1;
-        }
-        next_iteration_size = std::min<size_t>({next_iteration_size, keys.size() - already_done, max_base_table_query_concurrency});
-        auto key_it_end = key_it + next_iteration_size;
-
-        query::result_merger oneshot_merger(cmd->get_row_limit(), query::max_partitions);
-        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(key_it, key_it_end, coroutine::lambda([&] (auto& key)
-                -> future<coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>> {
-            auto command = ::make_lw_shared<query::read_command>(*cmd);
-            // for each partition, read just one clustering row (TODO: can
-            // get all needed rows of one partition at once.)
-            command->slice._row_ranges.clear();
+    using fetch_result = coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>;
+    // Reads the base rows of a group of keys of the same partition with a single command.
+    auto fetch = [&] (std::span<const primary_key> group) -> future<fetch_result> {
+        auto command = ::make_lw_shared<query::read_command>(*cmd);
+        command->slice._row_ranges.clear();
+        for (const auto& key : group) {
             if (key.clustering) {
                 command->slice._row_ranges.push_back(query::clustering_range::make_singular(key.clustering));
             }
-            coordinator_result<service::storage_proxy::coordinator_query_result> rqr
-                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(key.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
-            if (!rqr.has_value()) {
-                co_return std::move(rqr).as_failure();
+        }
+        coordinator_result<service::storage_proxy::coordinator_query_result> rqr
+                = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(group.front().partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+        if (!rqr.has_value()) {
+            co_return std::move(rqr).as_failure();
+        }
+        co_return std::move(rqr.value().query_result);
+    };
+    // Keys of one partition are adjacent in the index, in clustering order,
+    // so their rows can be read together. Keys without a clustering key
+    // (e.g. of an index on a static column) select the whole partition, and
+    // a key repeating the previous one (e.g. of an index on collection values)
+    // returns its row again, so both start a new read.
+    const clustering_key_prefix::less_compare ck_less(*_schema);
+    auto next_group = [&] {
+        auto group_end = std::next(key_it);
+        if (key_it->clustering) {
+            while (group_end != keys.end() && group_end->clustering
+                    && group_end->partition.equal(*_schema, key_it->partition)
+                    && ck_less(std::prev(group_end)->clustering, group_end->clustering)) {
+                ++group_end;
+            }
+        }
+        auto group = std::span<const primary_key>(key_it, group_end);
+        key_it = group_end;
+        return group;
+    };
+
+    // Reads are pipelined: up to `window` of them are in flight at any time,
+    // and their results are merged in key order as they complete. Starting
+    // with a single read, the window grows with the number of completed reads
+    // as long as the results are small, up to secondary_index_base_read_concurrency.
+    const size_t max_concurrency = std::max<size_t>(qp.get_cql_config().secondary_index_base_read_concurrency(), 1);
+    std::deque<future<fetch_result>> in_flight;
+    std::optional<fetch_result> failure;
+    std::exception_ptr ex;
+    size_t window = 1;
+    size_t completed = 0;
+    size_t result_size = 0;
+
+    const bool is_paged = bool(paging_state);
+    try {
+        for (;;) {
+            while (key_it != keys.end() && in_flight.size() < window) {
+                in_flight.push_back(fetch(next_group()));
+            }
+            if (in_flight.empty()) {
+                break;
+            }
+            auto rresult = co_await std::move(in_flight.front());
+            in_flight.pop_front();
+            if (!rresult.has_value()) {
+                failure = std::move(rresult);
+                break;
+            }
+            auto& result = rresult.value();
+            const auto is_short_read = result->is_short_read();
+            result_size += result->buf().size();
+            merger(std::move(result));
+            // Results larger than 1MB should be shipped to the client immediately
+            const bool page_limit_reached = is_paged && result_size >= query::result_memory_limiter::maximum_result_size;
+            if (is_short_read || page_limit_reached) {
+                break;
+            }
+            ++completed;
+            // If the results already provided 1MB worth of data,
+            // stop increasing the number of concurrent reads
+            if (result_size < query::result_memory_limiter::maximum_result_size) {
+                window = std::min(completed + 1, max_concurrency);
             }
-            co_return std::move(rqr.value().query_result);
-        }), std::move(oneshot_merger));
-        if (!rresult.has_value()) {
-            co_return std::move(rresult).as_failure();
-        }
-        auto& result = rresult.value();
-        auto is_short_read = result->is_short_read();
-        // Results larger than 1MB should be shipped to the client immediately
-        const bool page_limit_reached = is_paged && result->buf().size() >= query::result_memory_limiter::maximum_result_size;
-        previous_result_size = result->buf().size();
-        merger(std::move(result));
-        key_it = key_it_end;
-        if (is_short_read || page_limit_reached) {
-            break;
         }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    // Reads still in flight refer to this frame, so they have to be waited
+    // for even though their results are not needed.
+    for (auto& f : in_flight) {
+        co_await std::move(f).then_wrapped([] (future<fetch_result> f) {
+            f.ignore_ready_future();
+        });
+    }
+    if (ex) {
+        std::rethrow_exception(std::move(ex));
+    }
+    if (failure) {
+        co_return std::move(*failure).as_failure();
     }
     co_return value_type(merger.get(), std::move(cmd));
 }
@@ -1118,6 +1226,101 @@ view_indexed_table_select_statement::view_indexed_table_select_statement(schema_
         _get_partition_ranges_for_posting_list = [this] (const query_options& options) { return get_partition_ranges_for_global_index_posting_list(options); };
         _get_partition_slice_for_posting_list = [this] (const query_options& options) { return get_partition_slice_for_global_index_posting_list(options); };
     }
+    _covering_selection = make_covering_selection();
+}
+
+::shared_ptr<selection::selection> view_indexed_table_select_statement::make_covering_selection() const {
+    // Only the posting list of a global index on a regular column is read in
+    // the order (token, partition key, clustering key) the base query would
+    // return the rows in, and holds exactly one view row per base row.
+    if (_index.metadata().local() || _index.target_type() != cql3::statements::index_target::target_type::regular_values) {
+        return nullptr;
+    }
+    const column_definition* target = _schema->get_column_definition(to_bytes(_index.target_column()));
+    if (!target || !target->is_regular()) {
+        return nullptr;
+    }
+    if (!_selection->is_trivial() || _selection->is_aggregate() || has_group_by() || _parameters->is_json() || _parameters->is_distinct()
+            || _per_partition_limit || _is_reversed || needs_post_filtering() || _restrictions->has_clustering_columns_restriction()) {
+        return nullptr;
+    }
+    // Restrictions on the base partition key are translated to a slice of
+    // the posting list only when they pin the whole key or its token.
+    if (!_restrictions->partition_key_restrictions_is_empty()
+            && (_restrictions->has_partition_key_unrestricted_components()
+                || !(_restrictions->has_token_restrictions() || _restrictions->partition_key_restrictions_is_all_eq()))) {
+        return nullptr;
+    }
+    std::vector<const column_definition*> view_columns;
+    view_columns.reserve(_selection->get_columns().size());
+    for (const column_definition* cdef : _selection->get_columns()) {
+        const column_definition* view_cdef = _view_schema->get_column_definition(cdef->name());
+        if (!view_cdef || view_cdef->is_view_virtual() || view_cdef->is_computed()) {
+            return nullptr;
+        }
+        view_columns.push_back(view_cdef);
+    }
+    return selection::selection::for_columns(_view_schema, std::move(view_columns));
+}
+
+// Answers the query from the index view alone. The view rows come in the
+// same order as the base rows would, so the paging state handed to the
+// client is the same view position the two-step path produces.
+future<shared_ptr<cql_transport::messages::result_message>>
+view_indexed_table_select_statement::execute_covered_query(query_processor& qp, service::query_state& state, const query_options& options, gc_clock::time_point now) const {
+    dht::partition_range_vector partition_ranges = _get_partition_ranges_for_posting_list(options);
+    auto partition_slice = _get_partition_slice_for_posting_list(options);
+    partition_slice.static_columns.clear();
+    partition_slice.regular_columns.clear();
+    for (const column_definition* cdef : _covering_selection->get_columns()) {
+        if (cdef->is_regular()) {
+            partition_slice.regular_columns.push_back(cdef->id);
+        }
+    }
+    partition_slice.options = _covering_selection->get_query_options();
+    partition_slice.options.set_if<query::partition_slice::option::bypass_cache>(_parameters->bypass_cache());
+
+    auto cmd = ::make_lw_shared<query::read_command>(
+            _view_schema->id(),
+            _view_schema->version(),
+            partition_slice,
+            qp.proxy().get_max_result_size(partition_slice),
+            query::tombstone_limit(qp.proxy().get_tombstone_limit()),
+            query::row_limit(get_limit(options, _limit)),
+            query::partition_limit(query::max_partitions),
+            now,
+            tracing::make_trace_info(state.get_trace_state()),
+            query_id::create_null_id(),
+            query::is_first_page::no,
+            options.get_timestamp(state));
+
+    auto timeout = db::timeout_clock::now() + get_timeout(state.get_client_state(), options);
+    int32_t page_size = options.get_page_size();
+    if (page_size <= 0 || !service::pager::query_pagers::may_need_paging(*_view_schema, page_size, *cmd, partition_ranges)) {
+        auto qr = co_await qp.proxy().query_result(_view_schema, cmd, std::move(partition_ranges),
+                options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+        if (qr.has_error()) {
+            co_return failed_result_to_result_message(std::move(qr));
+        }
+        co_return ::make_shared<cql_transport::messages::result_message::rows>(result(
+                result_generator(_view_schema, std::move(qr.assume_value().query_result), std::move(cmd), _covering_selection, _stats),
+                _selection->get_result_metadata()));
+    }
+
+    cmd->slice.options.set<query::partition_slice::option::allow_short_read>();
+    auto p = service::pager::query_pagers::pager(qp.proxy(), _view_schema, _covering_selection,
+            state, options, cmd, std::move(partition_ranges), nullptr);
+    coordinator_result<result_generator> result_gen = co_await p->fetch_page_generator_result(page_size, now, timeout, _stats);
+    if (result_gen.has_error()) {
+        co_return failed_result_to_result_message(std::move(result_gen));
+    }
+    shared_ptr<const cql3::metadata> meta = _selection->get_result_metadata();
+    if (!p->is_exhausted()) {
+        auto paged_meta = make_shared<metadata>(*meta);
+        paged_meta->set_paging_state(p->state());
+        meta = std::move(paged_meta);
+    }
+    co_return ::make_shared<cql_transport::messages::result_message::rows>(result(std::move(result_gen).assume_value(), std::move(meta)));
 }
 
 template<typename KeyType>
@@ -1337,6 +1540,12 @@ view_indexed_table_select_statement::actually_do_execute(query_processor& qp,
         co_return shared_ptr<cql_transport::messages::result_message>(std::move(msg));
     }
 
+    if (_covering_selection) {
+        tracing::trace(state.get_trace_state(), "Index {} covers all selected columns, skipping base table reads", _index.metadata().name());
+        ++_stats.secondary_index_covered_reads;
+        co_return co_await execute_covered_query(qp, state, options, now);
+    }
+
     if (whole_partitions || partition_slices) {
         tracing::trace(state.get_trace_state(), "Consulting index {} for a single slice of keys", _index.metadata().name());
         // In this case, can use our normal query machinery, which retrieves
@@ -197,9 +197,12 @@ class view_indexed_table_select_statement : public select_statement {
     schema_ptr _view_schema;
     noncopyable_function<dht::partition_range_vector(const query_options&)> _get_partition_ranges_for_posting_list;
     noncopyable_function<query::partition_slice(const query_options&)> _get_partition_slice_for_posting_list;
+    // Selection of the index view's columns matching _selection, set when
+    // every selected column is stored in the index view (e.g. as one of the
+    // index's included columns) and the query can be answered without
+    // reading the base table.
+    ::shared_ptr<selection::selection> _covering_selection;
 public:
-    static constexpr size_t max_base_table_query_concurrency = 4096;
-
     static ::shared_ptr<cql3::statements::select_statement> prepare(data_dictionary::database db,
                                                                     schema_ptr schema,
                                                                     uint32_t bound_terms,
@@ -236,6 +239,11 @@ class view_indexed_table_select_statement : public select_statement {
     future<::shared_ptr<cql_transport::messages::result_message>> actually_do_execute(query_processor& qp,
             service::query_state& state, const query_options& options) const;
 
+    ::shared_ptr<selection::selection> make_covering_selection() const;
+
+    future<::shared_ptr<cql_transport::messages::result_message>> execute_covered_query(query_processor& qp,
+            service::query_state& state, const query_options& options, gc_clock::time_point now) const;
+
     lw_shared_ptr<const service::pager::paging_state> generate_view_paging_state_from_base_query_results(lw_shared_ptr<const service::pager::paging_state> paging_state,
             const foreign_ptr<lw_shared_ptr<query::result>>& results, service::query_state& state, const query_options& options, uint32_t internal_page_size) const;
 
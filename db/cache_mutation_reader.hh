@@ -137,6 +137,7 @@ class cache_mutation_reader final : public mutation_reader::impl {
     void move_to_range(query::clustering_row_ranges::const_iterator);
     void move_to_next_entry();
     void maybe_drop_last_entry(tombstone) noexcept;
+    bool rejected_by_clustering_filter(const clustering_key&) const;
     void add_to_buffer(const partition_snapshot_row_cursor&);
     void add_clustering_row_to_buffer(mutation_fragment_v2&&);
     void add_to_buffer(range_tombstone_change&&);
@@ -1006,6 +1007,10 @@ void cache_mutation_reader::offer_from_underlying(mutation_fragment_v2&& mf) {
     clogger.trace("csm {}: offer_from_underlying({})", fmt::ptr(this), mutation_fragment_v2::printer(*_schema, mf));
     if (mf.is_clustering_row()) {
         maybe_add_to_cache(mf.as_clustering_row());
+        if (rejected_by_clustering_filter(mf.as_clustering_row().key())) {
+            add_clustering_row_to_buffer(mutation_fragment_v2(*_schema, _permit, clustering_row(mf.as_clustering_row().key())));
+            return;
+        }
         add_clustering_row_to_buffer(std::move(mf));
     } else {
         SCYLLA_ASSERT(mf.is_range_tombstone_change());
@@ -1016,11 +1021,23 @@ void cache_mutation_reader::offer_from_underlying(mutation_fragment_v2&& mf) {
     }
 }
 
+// Rejected rows are emitted with only their key, the query compactor drops
+// them. Their contents are stripped only after they were populated into the
+// cache, which is why the underlying readers are not given the filter.
+inline
+bool cache_mutation_reader::rejected_by_clustering_filter(const clustering_key& key) const {
+    return _read_context.slice().has_clustering_filter() && !_read_context.slice().clustering_filter_matches(*_schema, key);
+}
+
 inline
 void cache_mutation_reader::add_to_buffer(const partition_snapshot_row_cursor& row) {
     position_in_partition::less_compare less(*_schema);
     if (!row.dummy()) {
         _read_context.cache().on_row_hit();
+        if (rejected_by_clustering_filter(row.key())) {
+            add_clustering_row_to_buffer(mutation_fragment_v2(*_schema, _permit, clustering_row(row.key())));
+            return;
+        }
         if (_read_context.digest_requested()) {
             row.latest_row_prepare_hash();
         }
@@ -872,6 +872,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Log a warning when writing a collection containing more elements than this value.")
     , compaction_large_data_records_per_sstable(this, "compaction_large_data_records_per_sstable", liveness::LiveUpdate, value_status::Used, 10,
         "Maximum number of large data records per type to store in each SSTable's scylla metadata.")
+    , hot_partitions_sample_period(this, "hot_partitions_sample_period", liveness::LiveUpdate, value_status::Used, 16,
+        "Sample on average one in this many replica reads and writes to track the hottest partitions of each shard, "
+        "as reported by system.hot_partitions and the REST API. Set to 0 to disable.")
     /**
     * @Group Common memtable settings
     */
@@ -1266,6 +1269,29 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Enable or disable keepalive on client connections (CQL native and the maintenance socket).")
     , cache_hit_rate_read_balancing(this, "cache_hit_rate_read_balancing", value_status::Used, true,
         "This boolean controls whether the replicas for read query will be chosen based on cache hit ratio.")
+    , coordinator_read_cache_ttl_in_ms(this, "coordinator_read_cache_ttl_in_ms", liveness::LiveUpdate, value_status::Used, 100,
+        "How long, in milliseconds, the coordinator may serve the result of a read of a hot partition from its cache, "
+        "for tables with caching = {'coordinator': 'true'} and reads at consistency level ONE or LOCAL_ONE. "
+        "This bounds the staleness of such reads. Set to 0 to disable the coordinator read cache.")
+    , coordinator_read_cache_hot_threshold(this, "coordinator_read_cache_hot_threshold", liveness::LiveUpdate, value_status::Used, 1000,
+        "Approximate rate of reads per second, coordinated by a single shard, above which a partition is considered hot "
+        "and its reads are served from the coordinator read cache.")
+    , adaptive_speculative_retry(this, "adaptive_speculative_retry", liveness::LiveUpdate, value_status::Used, false,
+        "For tables with a PERCENTILE speculative_retry, time the speculative retry of a read from the latency predicted for the replicas "
+        "it was sent to, tracked per replica and table by the coordinator, instead of from the table's coordinator read latency percentile. "
+        "The number of speculative retries is then limited by adaptive_speculative_retry_budget.")
+    , adaptive_speculative_retry_budget(this, "adaptive_speculative_retry_budget", liveness::LiveUpdate, value_status::Used, 0.1,
+        "Maximum ratio of speculative retries to reads, per shard, when adaptive_speculative_retry is enabled. "
+        "Retries beyond it are not sent, which keeps an overloaded cluster, where every replica is slower than predicted, "
+        "from being loaded further with retries.")
+    , replica_read_coalescing(this, "replica_read_coalescing", liveness::LiveUpdate, value_status::Used, false,
+        "When enabled, a single-partition read arriving at a replica shard while an identical read (same partition, slice, limits "
+        "and query time) executes there waits for that read and gets a copy of its result, instead of reading the partition again. "
+        "Helps with many clients reading the same partition at the same time.")
+    , memtable_write_batching(this, "memtable_write_batching", liveness::LiveUpdate, value_status::Used, false,
+        "When enabled, small writes to the same table arriving at a replica shard in the same task quota, such as the "
+        "mutations of an UNLOGGED BATCH, are applied to the memtable together, in one allocating section, instead of "
+        "one by one.")
     /**
     * @Group Advanced fault detection settings
     * @GroupDescription Settings to handle poorly performing or failing nodes.
@@ -1459,6 +1485,7 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , force_gossip_generation(this, "force_gossip_generation", liveness::LiveUpdate, value_status::Used, -1 , "Force gossip to use the generation number provided by user.")
     , experimental_features(this, "experimental_features", value_status::Used, {}, experimental_features_help_string())
     , lsa_reclamation_step(this, "lsa_reclamation_step", value_status::Used, 1, "Minimum number of segments to reclaim in a single step.")
+    , lsa_idle_free_segments(this, "lsa_idle_free_segments", value_status::Used, 0, "Number of free LSA segments to prepare by compacting the sparsest segments when the cpu is idle and free memory is low, so that allocations do not have to compact synchronously. Set to zero to disable. Has no effect when defragment_memory_on_idle is set, which compacts as much as possible instead.")
     , prometheus_port(this, "prometheus_port", value_status::Used, 9180, "Prometheus port, set to zero to disable.")
     , prometheus_address(this, "prometheus_address", value_status::Used, {/* listen_address */}, "Prometheus listening address, defaulting to listen_address if not explicitly set.")
     , prometheus_prefix(this, "prometheus_prefix", value_status::Used, "scylla", "Set the prefix of the exported Prometheus metrics. Changing this will break Scylla's dashboard compatibility, do not change unless you know what you are doing.")
@@ -1605,6 +1632,12 @@ db::config::config(std::shared_ptr<db::extensions> exts)
             "Make the system.config table UPDATEable.")
     , enable_parallelized_aggregation(this, "enable_parallelized_aggregation", liveness::LiveUpdate, value_status::Used, true,
             "Use on a new, parallel algorithm for performing aggregate queries.")
+    , enable_local_aggregation_pushdown(this, "enable_local_aggregation_pushdown", liveness::LiveUpdate, value_status::Used, true,
+            "Fold the rows of parallelized aggregate queries at consistency level ONE or LOCAL_ONE into the aggregates as they are read "
+            "from the local replica, instead of building and parsing query result pages. Applies to the ranges this node is a replica of.")
+    , cql_migrate_single_partition_reads(this, "cql_migrate_single_partition_reads", liveness::LiveUpdate, value_status::Used, false,
+            "Execute a single-partition read received on a shard which doesn't own the partition on the owning shard, when this node is one of its replicas. "
+            "Helps clients which are not shard-aware, by avoiding the cross-shard copy of the read result.")
     , cql_duplicate_bind_variable_names_refer_to_same_variable(this, "cql_duplicate_bind_variable_names_refer_to_same_variable", liveness::LiveUpdate, value_status::Used, true,
             "A bind variable that appears twice in a CQL query refers to a single variable (if false, no name matching is performed).")
     , cql_in_bind_variable_name_uses_uppercase_operator(this, "cql_in_bind_variable_name_uses_uppercase_operator", liveness::LiveUpdate, value_status::Used, true,
@@ -1613,6 +1646,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
             "Maximum number of relations allowed in a WHERE clause. Queries with too many relations can cause quadratic complexity.")
     , select_internal_page_size(this, "select_internal_page_size", liveness::LiveUpdate, value_status::Used, 10000,
             "SELECT statements with aggregation or GROUP BYs or a secondary index may use this page size for their internal reading data, not the page size specified in the query options.")
+    , secondary_index_base_read_concurrency(this, "secondary_index_base_read_concurrency", liveness::LiveUpdate, value_status::Used, 4096,
+            "Maximum number of base table reads a SELECT using a global secondary index keeps in flight while fetching the rows of the keys found in the index, "
+            "and of vnode ranges it reads at once when the index returns partition ranges.")
     , alternator_port(this, "alternator_port", value_status::Used, 0, "Alternator API port.")
     , alternator_https_port(this, "alternator_https_port", value_status::Used, 0, "Alternator API HTTPS port.")
     , alternator_port_proxy_protocol(this, "alternator_port_proxy_protocol", value_status::Used, 0,
@@ -1805,10 +1841,14 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "true: auto-adjust memtable shares for flush processes")
     , memtable_flush_static_shares(this, "memtable_flush_static_shares", liveness::LiveUpdate, value_status::Used, 0,
         "If set to higher than 0, ignore the controller's output and set the memtable shares statically. Do not set this unless you know what you are doing and suspect a problem in the controller. This option will be retired when the controller reaches more maturity.")
+    , memtable_flush_max_parallel_writers(this, "memtable_flush_max_parallel_writers", liveness::LiveUpdate, value_status::Used, 4,
+        "Maximum number of sstables written concurrently by a single memtable flush. Memtables larger than 128MB are split into disjoint token ranges, one per 128MB of memtable data up to this many, and the ranges are flushed in parallel into sstables of a single run. Set to 1 to always flush into a single sstable. Tables whose compaction strategy segregates flushed data (e.g. TimeWindowCompactionStrategy) are always flushed with a single writer.")
     , compaction_static_shares(this, "compaction_static_shares", liveness::LiveUpdate, value_status::Used, 0,
         "If set to higher than 0, ignore the controller's output and set the compaction shares statically. Do not set this unless you know what you are doing and suspect a problem in the controller. This option will be retired when the controller reaches more maturity.")
     , compaction_max_shares(this, "compaction_max_shares", liveness::LiveUpdate, value_status::Used, default_compaction_maximum_shares,
         "Set the maximum shares of regular compaction to the specific value. Do not set this unless you know what you are doing and suspect a problem in the controller. This option will be retired when the controller reaches more maturity.")
+    , compaction_read_amplification_target(this, "compaction_read_amplification_target", liveness::LiveUpdate, value_status::Used, 0,
+        "If set to higher than 0, the compaction controller tracks the p99 of sstables touched per single-partition read of each table, and raises compaction shares while the worst table exceeds this target. The boost is reduced under memtable flush pressure. Lower values trade write amplification for read latency.")
     , compaction_enforce_min_threshold(this, "compaction_enforce_min_threshold", liveness::LiveUpdate, value_status::Used, false,
         "If set to true, enforce the min_threshold option for compactions strictly. If false (default), Scylla may decide to compact even if below min_threshold.")
     , compaction_flush_all_tables_before_major_seconds(this, "compaction_flush_all_tables_before_major_seconds", value_status::Used, 86400,
@@ -246,6 +246,7 @@ class config final : public utils::config_file {
     named_value<uint32_t> compaction_rows_count_warning_threshold;
     named_value<uint32_t> compaction_collection_elements_count_warning_threshold;
     named_value<uint32_t> compaction_large_data_records_per_sstable;
+    named_value<uint32_t> hot_partitions_sample_period;
     named_value<uint32_t> memtable_total_space_in_mb;
     named_value<uint32_t> concurrent_reads;
     named_value<uint32_t> concurrent_writes;
@@ -370,6 +371,12 @@ class config final : public utils::config_file {
     named_value<bool> start_rpc;
     named_value<bool> rpc_keepalive;
     named_value<bool> cache_hit_rate_read_balancing;
+    named_value<uint32_t> coordinator_read_cache_ttl_in_ms;
+    named_value<uint32_t> coordinator_read_cache_hot_threshold;
+    named_value<bool> adaptive_speculative_retry;
+    named_value<double> adaptive_speculative_retry_budget;
+    named_value<bool> replica_read_coalescing;
+    named_value<bool> memtable_write_batching;
     named_value<double> dynamic_snitch_badness_threshold;
     named_value<uint32_t> dynamic_snitch_reset_interval_in_ms;
     named_value<uint32_t> dynamic_snitch_update_interval_in_ms;
@@ -437,6 +444,7 @@ class config final : public utils::config_file {
     named_value<int32_t> force_gossip_generation;
     named_value<std::vector<enum_option<experimental_features_t>>> experimental_features;
     named_value<size_t> lsa_reclamation_step;
+    named_value<size_t> lsa_idle_free_segments;
     named_value<uint16_t> prometheus_port;
     named_value<sstring> prometheus_address;
     named_value<sstring> prometheus_prefix;
@@ -508,10 +516,13 @@ class config final : public utils::config_file {
     named_value<tri_mode_restriction> strict_is_not_null_in_views;
     named_value<bool> enable_cql_config_updates;
     named_value<bool> enable_parallelized_aggregation;
+    named_value<bool> enable_local_aggregation_pushdown;
+    named_value<bool> cql_migrate_single_partition_reads;
     named_value<bool> cql_duplicate_bind_variable_names_refer_to_same_variable;
     named_value<bool> cql_in_bind_variable_name_uses_uppercase_operator;
     named_value<uint32_t> max_relations_in_where_clause;
     named_value<uint32_t> select_internal_page_size;
+    named_value<uint32_t> secondary_index_base_read_concurrency;
 
     named_value<uint16_t> alternator_port;
     named_value<uint16_t> alternator_https_port;
@@ -669,8 +680,10 @@ class config final : public utils::config_file {
     named_value<double> background_writer_scheduling_quota;
     named_value<bool> auto_adjust_flush_quota;
     named_value<float> memtable_flush_static_shares;
+    named_value<uint32_t> memtable_flush_max_parallel_writers;
     named_value<float> compaction_static_shares;
     named_value<float> compaction_max_shares;
+    named_value<float> compaction_read_amplification_target;
     named_value<bool> compaction_enforce_min_threshold;
     named_value<uint32_t> compaction_flush_all_tables_before_major_seconds;
 
@@ -10,6 +10,9 @@
 #include "replica/database.hh"
 #include "readers/filtering.hh"
 
+#include <seastar/core/coroutine.hh>
+
+#include <map>
 #include <tuple>
 
 extern logging::logger dblog;
@@ -151,4 +154,166 @@ future<toppartitions_query::results> toppartitions_query::gather(unsigned res_si
         });
 }
 
+hot_partitions_tracker::hot_partitions_tracker(config cfg)
+        : _cfg(std::move(cfg))
+        , _reads(_cfg.capacity)
+        , _writes(_cfg.capacity)
+        , _rng(std::random_device{}())
+        , _decay_timer([this] { decay(); }) {
+    _decay_timer.arm_periodic(_cfg.decay_period);
+}
+
+uint32_t hot_partitions_tracker::sample() noexcept {
+    const auto period = _cfg.sample_period();
+    if (!period || --_countdown) {
+        return 0;
+    }
+    // Skip a random number of operations averaging to the sampling period,
+    // so that periodic access patterns are not systematically missed.
+    _countdown = std::uniform_int_distribution<uint32_t>(1, 2 * period - 1)(_rng);
+    return period;
+}
+
+hot_partitions_tracker::table_load& hot_partitions_tracker::load_of(const schema& s) {
+    auto [it, inserted] = _tables.try_emplace(s.id());
+    if (inserted) {
+        it->second.keyspace = s.ks_name();
+        it->second.table = s.cf_name();
+    }
+    return it->second;
+}
+
+void hot_partitions_tracker::on_write(const schema_ptr& s, const frozen_mutation& m) noexcept {
+    const auto weight = sample();
+    if (!weight) {
+        return;
+    }
+    try {
+        auto& load = load_of(*s);
+        load.writes += weight;
+        load.write_bytes += uint64_t(weight) * m.representation().size();
+        _writes.append(toppartitions_item_key{s, m.decorated_key(*s)}, weight);
+    } catch (...) {
+        // Tracking is best-effort, it must never fail the write. A sketch
+        // left invalid by the failure is reset on the next decay.
+        dblog.debug("hot_partitions_tracker: failed to record write: {}", std::current_exception());
+    }
+}
+
+void hot_partitions_tracker::on_read(const schema_ptr& s, std::span<const dht::partition_range> ranges, size_t result_size) noexcept {
+    const auto weight = sample();
+    if (!weight) {
+        return;
+    }
+    try {
+        auto& load = load_of(*s);
+        load.reads += weight;
+        load.read_bytes += uint64_t(weight) * result_size;
+        for (const auto& range : ranges) {
+            if (range.is_singular() && range.start()->value().has_key()) {
+                _reads.append(toppartitions_item_key{s, range.start()->value().as_decorated_key()}, weight);
+            }
+        }
+    } catch (...) {
+        dblog.debug("hot_partitions_tracker: failed to record read: {}", std::current_exception());
+    }
+}
+
+void hot_partitions_tracker::decay() {
+    auto decay_sketch = [this] (top_k& sketch) {
+        top_k decayed(_cfg.capacity);
+        try {
+            if (sketch.valid()) {
+                for (auto& e : sketch.top(_cfg.capacity)) {
+                    if (e.count / 2) {
+                        decayed.append(e.item, e.count / 2, e.error / 2);
+                    }
+                }
+            }
+        } catch (...) {
+            dblog.debug("hot_partitions_tracker: failed to decay, resetting: {}", std::current_exception());
+            decayed = top_k(_cfg.capacity);
+        }
+        sketch = std::move(decayed);
+    };
+    decay_sketch(_reads);
+    decay_sketch(_writes);
+
+    std::erase_if(_tables, [] (auto& e) {
+        auto& load = e.second;
+        load.reads /= 2;
+        load.writes /= 2;
+        load.read_bytes /= 2;
+        load.write_bytes /= 2;
+        return !load.reads && !load.writes;
+    });
+}
+
+hot_partitions_tracker::snapshot hot_partitions_tracker::get_snapshot(size_t k) const {
+    auto to_hot_partitions = [k] (const top_k& sketch) {
+        std::vector<hot_partition> ret;
+        if (!sketch.valid()) {
+            return ret;
+        }
+        for (auto& e : sketch.top(k)) {
+            ret.push_back(hot_partition{
+                .keyspace = e.item.schema->ks_name(),
+                .table = e.item.schema->cf_name(),
+                .key = sstring(e.item),
+                .count = e.count,
+                .error = e.error,
+            });
+        }
+        return ret;
+    };
+
+    snapshot ret;
+    ret.reads = to_hot_partitions(_reads);
+    ret.writes = to_hot_partitions(_writes);
+    ret.tables.reserve(_tables.size());
+    for (auto& [_, load] : _tables) {
+        ret.tables.push_back(load);
+    }
+    return ret;
+}
+
+hot_partitions_tracker::snapshot hot_partitions_tracker::merge(std::vector<snapshot> shards, size_t k) {
+    // A partition is owned by a single shard, so the per-shard lists are
+    // disjoint and merging them only needs a re-ranking.
+    auto merge_partitions = [k] (std::vector<hot_partition>& to, std::vector<hot_partition>& from) {
+        std::ranges::move(from, std::back_inserter(to));
+        std::ranges::sort(to, std::greater<>(), &hot_partition::count);
+        if (to.size() > k) {
+            to.resize(k);
+        }
+    };
+
+    snapshot ret;
+    std::map<std::pair<sstring, sstring>, table_load> tables;
+    for (auto& shard : shards) {
+        merge_partitions(ret.reads, shard.reads);
+        merge_partitions(ret.writes, shard.writes);
+        for (auto& load : shard.tables) {
+            auto& l = tables[std::pair(load.keyspace, load.table)];
+            l.keyspace = load.keyspace;
+            l.table = load.table;
+            l.reads += load.reads;
+            l.writes += load.writes;
+            l.read_bytes += load.read_bytes;
+            l.write_bytes += load.write_bytes;
+        }
+    }
+    for (auto& [_, load] : tables) {
+        ret.tables.push_back(std::move(load));
+    }
+    return ret;
+}
+
+future<hot_partitions_tracker::snapshot> hot_partitions_tracker::gather(sharded<replica::database>& db, size_t k) {
+    auto shards = co_await db.map([k] (replica::database& db) {
+        return db.hot_partitions().get_snapshot(k);
+    });
+    co_return merge(std::move(shards), k);
+}
+
 } // namespace db
@@ -11,14 +11,19 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/future.hh>  // IWYU pragma: keep
 #include <seastar/core/weak_ptr.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/core/lowres_clock.hh>
 
 #include "utils/hash.hh"
 #include "schema/schema_fwd.hh"
 #include "readers/mutation_reader.hh"
 #include "utils/top_k.hh"
 #include "schema/schema_registry.hh"
+#include "utils/updateable_value.hh"
 
+#include <random>
 #include <set>
+#include <span>
 
 class frozen_mutation;
 
@@ -165,4 +170,80 @@ class toppartitions_query {
     future<results> gather(unsigned results_size = 256);
 };
 
+// Always-on tracker of the hottest partitions of a shard.
+//
+// Unlike toppartitions_data_listener, which is installed for the duration of
+// an explicit query and sees every operation, this tracker runs all the time,
+// so it only looks at a random sample of the replica reads and writes (one in
+// sample_period on average). Sampled partitions are fed to space-saving
+// sketches, weighted by the sampling period, and the counts are halved every
+// decay_period so that the lists follow the recent load rather than the
+// all-time one. Per-table operation and byte counts are estimated from the
+// same samples and decay the same way.
+class hot_partitions_tracker {
+public:
+    using top_k = toppartitions_data_listener::top_k;
+
+    struct config {
+        // 0 disables tracking.
+        utils::updateable_value<uint32_t> sample_period;
+        size_t capacity = 256;
+        std::chrono::seconds decay_period = std::chrono::seconds(60);
+    };
+
+    struct table_load {
+        sstring keyspace;
+        sstring table;
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t read_bytes = 0;
+        uint64_t write_bytes = 0;
+    };
+
+    struct hot_partition {
+        sstring keyspace;
+        sstring table;
+        sstring key;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    struct snapshot {
+        std::vector<hot_partition> reads;
+        std::vector<hot_partition> writes;
+        std::vector<table_load> tables;
+    };
+
+private:
+    config _cfg;
+    top_k _reads;
+    top_k _writes;
+    std::unordered_map<table_id, table_load> _tables;
+    uint32_t _countdown = 1;
+    std::default_random_engine _rng;
+    timer<lowres_clock> _decay_timer;
+
+private:
+    // Returns the weight of the current operation if it is sampled, 0 otherwise.
+    uint32_t sample() noexcept;
+    table_load& load_of(const schema& s);
+    void decay();
+    static snapshot merge(std::vector<snapshot> shards, size_t k);
+
+public:
+    explicit hot_partitions_tracker(config cfg);
+
+    void on_write(const schema_ptr& s, const frozen_mutation& m) noexcept;
+    // Invoked once per query, with the size of its result. Only the singular
+    // ranges are attributed to partitions.
+    void on_read(const schema_ptr& s, std::span<const dht::partition_range> ranges, size_t result_size) noexcept;
+
+    // Returns at most `k` hottest partitions for reads and for writes, and
+    // the load of all tables seen since they last decayed to zero.
+    snapshot get_snapshot(size_t k) const;
+
+    // Combines the snapshots of all shards, keeping the `k` hottest partitions.
+    static future<snapshot> gather(sharded<replica::database>& db, size_t k);
+};
+
 } // namespace db
@@ -125,9 +125,8 @@ class rate_limiter_base {
     rate_limiter_base& operator=(const rate_limiter_base&) = delete;
     rate_limiter_base& operator=(rate_limiter_base&&) = delete;
 
-    // (For testing purposes only)
     // Increments the counter for given (label, token) and returns
-    // the new value of the counter.
+    // the new value of the counter, without enforcing any limit.
     uint64_t increase_and_get_counter(label& l, uint64_t token) noexcept;
 
     // Increments the counter for given (label, token).
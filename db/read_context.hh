@@ -122,6 +122,9 @@ class read_context final : public enable_lw_shared_from_this<read_context> {
     reader_permit _permit;
     const dht::partition_range& _range;
     const query::partition_slice& _slice;
+    // Copy of _slice without the clustering filter, for the underlying
+    // readers, as rows they emit are used to populate the cache.
+    std::optional<query::partition_slice> _unfiltered_slice;
     tracing::trace_state_ptr _trace_state;
     mutation_reader::forwarding _fwd_mr;
     bool _range_query;
@@ -166,6 +169,10 @@ class read_context final : public enable_lw_shared_from_this<read_context> {
         , _underlying(_cache, *this)
     {
         ++_cache._tracker._stats.reads;
+        if (_slice.has_clustering_filter()) {
+            _unfiltered_slice.emplace(_slice);
+            _unfiltered_slice->set_clustering_filter({});
+        }
         if (!_range_query) {
             _key = range.start()->value().as_decorated_key();
         }
@@ -188,6 +195,8 @@ class read_context final : public enable_lw_shared_from_this<read_context> {
     bool is_reversed() const { return _slice.is_reversed(); }
     // Returns a slice in the native format (for reversed reads, in native-reversed format).
     const query::partition_slice& native_slice() const { return _slice; }
+    // The slice to use for reading from the underlying mutation source.
+    const query::partition_slice& underlying_slice() const { return _unfiltered_slice ? *_unfiltered_slice : _slice; }
     tracing::trace_state_ptr trace_state() const { return _trace_state; }
     mutation_reader::forwarding fwd_mr() const { return _fwd_mr; }
     bool is_range_query() const { return _range_query; }
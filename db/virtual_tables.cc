@@ -19,6 +19,7 @@
 #include "cdc/log.hh"
 #include "cdc/metadata.hh"
 #include "db/config.hh"
+#include "db/data_listeners.hh"
 #include "db/system_keyspace.hh"
 #include "db/virtual_table.hh"
 #include "partition_slice_builder.hh"
@@ -1330,6 +1331,129 @@ class tablet_sizes : public group0_virtual_table {
     }
 };
 
+// Lists the hottest partitions of this node, as tracked continuously by
+// db::hot_partitions_tracker from a sample of the replica reads and writes.
+// For every table and operation, the row with rank 0 holds the estimated
+// load of the whole table, the following ranks list its hot partitions.
+class hot_partitions_table : public streaming_virtual_table {
+    sharded<replica::database>& _db;
+
+    static constexpr size_t list_size = 100;
+
+    struct table_rows {
+        dht::decorated_key dk;
+        const db::hot_partitions_tracker::table_load* load = nullptr;
+        std::vector<const db::hot_partitions_tracker::hot_partition*> reads;
+        std::vector<const db::hot_partitions_tracker::hot_partition*> writes;
+    };
+
+public:
+    explicit hot_partitions_table(sharded<replica::database>& db)
+            : streaming_virtual_table(build_schema())
+            , _db(db)
+    {
+        _shard_aware = true;
+    }
+
+    static schema_ptr build_schema() {
+        auto id = generate_legacy_id(system_keyspace::NAME, "hot_partitions");
+        return schema_builder(this_smp_shard_count(), system_keyspace::NAME, "hot_partitions", std::make_optional(id))
+            .with_column("keyspace_name", utf8_type, column_kind::partition_key)
+            .with_column("table_name", utf8_type, column_kind::partition_key)
+            .with_column("operation", utf8_type, column_kind::clustering_key)
+            .with_column("rank", int32_type, column_kind::clustering_key)
+            .with_column("partition_key", utf8_type)
+            .with_column("count", long_type)
+            .with_column("error", long_type)
+            .with_column("bytes", long_type)
+            .set_comment("Hottest partitions of this node, estimated from a sample of the recent reads and writes. "
+                    "Rank 0 holds the load of the whole table.")
+            .with_hash_version()
+            .build();
+    }
+
+    dht::decorated_key make_partition_key(const sstring& ks_name, const sstring& cf_name) {
+        return dht::decorate_key(*_s, partition_key::from_exploded(*_s, {
+            data_value(ks_name).serialize_nonnull(),
+            data_value(cf_name).serialize_nonnull()
+        }));
+    }
+
+    clustering_key make_clustering_key(const sstring& operation, int32_t rank) {
+        return clustering_key::from_exploded(*_s, {
+            data_value(operation).serialize_nonnull(),
+            data_value(rank).serialize_nonnull()
+        });
+    }
+
+    future<> execute(reader_permit permit, result_collector& result, const query_restrictions& qr) override {
+        auto hot = co_await db::hot_partitions_tracker::gather(_db, list_size);
+
+        std::map<std::pair<sstring, sstring>, table_rows> tables;
+        auto table_for = [&] (const sstring& ks, const sstring& cf) -> table_rows* {
+            auto it = tables.find(std::pair(ks, cf));
+            if (it == tables.end()) {
+                auto dk = make_partition_key(ks, cf);
+                if (!this_shard_owns(dk) || !contains_key(qr.partition_range(), dk)) {
+                    return nullptr;
+                }
+                it = tables.emplace(std::pair(ks, cf), table_rows{std::move(dk)}).first;
+            }
+            return &it->second;
+        };
+        for (const auto& load : hot.tables) {
+            if (auto t = table_for(load.keyspace, load.table)) {
+                t->load = &load;
+            }
+        }
+        for (const auto& p : hot.reads) {
+            if (auto t = table_for(p.keyspace, p.table)) {
+                t->reads.push_back(&p);
+            }
+        }
+        for (const auto& p : hot.writes) {
+            if (auto t = table_for(p.keyspace, p.table)) {
+                t->writes.push_back(&p);
+            }
+        }
+
+        std::vector<table_rows*> sorted;
+        sorted.reserve(tables.size());
+        for (auto& [_, t] : tables) {
+            sorted.push_back(&t);
+        }
+        std::ranges::sort(sorted, dht::ring_position_less_comparator(*_s), [] (const table_rows* t) -> const dht::decorated_key& {
+            return t->dk;
+        });
+
+        auto emit_operation = [&] (const sstring& operation, std::optional<std::pair<uint64_t, uint64_t>> load,
+                const std::vector<const db::hot_partitions_tracker::hot_partition*>& partitions) -> future<> {
+            if (load) {
+                clustering_row cr(make_clustering_key(operation, 0));
+                set_cell(cr.cells(), "count", int64_t(load->first));
+                set_cell(cr.cells(), "bytes", int64_t(load->second));
+                co_await result.emit_row(std::move(cr));
+            }
+            int32_t rank = 1;
+            for (auto p : partitions) {
+                clustering_row cr(make_clustering_key(operation, rank++));
+                set_cell(cr.cells(), "partition_key", p->key);
+                set_cell(cr.cells(), "count", int64_t(p->count));
+                set_cell(cr.cells(), "error", int64_t(p->error));
+                co_await result.emit_row(std::move(cr));
+            }
+        };
+
+        for (auto t : sorted) {
+            using load_opt = std::optional<std::pair<uint64_t, uint64_t>>;
+            co_await result.emit_partition_start(t->dk);
+            co_await emit_operation("read", t->load ? load_opt(std::pair(t->load->reads, t->load->read_bytes)) : std::nullopt, t->reads);
+            co_await emit_operation("write", t->load ? load_opt(std::pair(t->load->writes, t->load->write_bytes)) : std::nullopt, t->writes);
+            co_await result.emit_partition_end();
+        }
+    }
+};
+
 class cdc_timestamps_table : public streaming_virtual_table {
 private:
     replica::database& _db;
@@ -2110,6 +2234,7 @@ future<> initialize_virtual_tables(
         co_await add_table(std::make_unique<tablet_sizes>(tablet_allocator, dist_db, dist_raft_gr, ms));
         co_await add_table(std::make_unique<cdc_timestamps_table>(db, dist_ss.local()));
         co_await add_table(std::make_unique<cdc_streams_table>(db, dist_ss.local()));
+        co_await add_table(std::make_unique<hot_partitions_table>(dist_db));
 
         db.find_column_family(system_keyspace::size_estimates()).set_virtual_reader(mutation_source(db::size_estimates::virtual_reader(db, sys_ks.local())));
         db.find_column_family(system_keyspace::views_builds_in_progress()).set_virtual_reader(mutation_source(db::view::build_progress_virtual_reader(db)));
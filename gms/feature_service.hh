@@ -196,6 +196,9 @@ class feature_service final : public peering_sharded_service<feature_service> {
     // RPCs (and their warnings) to nodes that do not register the verb during a
     // rolling upgrade.
     gms::feature small_table_optimization_size_probe { *this, "SMALL_TABLE_OPTIMIZATION_SIZE_PROBE"sv };
+    // Replicas understand query::partition_slice::clustering_filter(), so
+    // filtering queries can push clustering column restrictions down to them.
+    gms::feature clustering_filter_pushdown { *this, "CLUSTERING_FILTER_PUSHDOWN"sv };
 public:
 
     const std::unordered_map<sstring, std::reference_wrapper<feature>>& registered_features() const;
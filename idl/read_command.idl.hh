@@ -23,6 +23,19 @@ class specific_ranges {
     std::vector<interval<clustering_key_prefix>> ranges();
 };
 
+struct clustering_column_restriction {
+    enum class op : uint8_t {
+        eq,
+        lt,
+        lte,
+        gt,
+        gte
+    };
+    uint32_t column;
+    query::clustering_column_restriction::op oper;
+    std::vector<bytes> values;
+};
+
 // COMPATIBILITY NOTE: the partition-slice for reverse queries has two different
 // format:
 // * legacy format
@@ -38,6 +51,7 @@ class partition_slice {
     cql_serialization_format cql_format();
     uint32_t partition_row_limit_low_bits() [[version 1.3]] = std::numeric_limits<uint32_t>::max();
     uint32_t partition_row_limit_high_bits() [[version 4.3]] = 0;
+    std::vector<query::clustering_column_restriction> clustering_filter() [[version 2026.4]];
 };
 
 struct max_result_size {
@@ -20,6 +20,7 @@
 
 const sstring db::index::secondary_index::custom_class_option_name = "class_name";
 const sstring db::index::secondary_index::index_version_option_name = "index_version";
+const sstring db::index::secondary_index::included_columns_option_name = "included_columns";
 
 namespace secondary_index {
 
@@ -25,6 +25,7 @@ class secondary_index {
 public:
     static const sstring custom_class_option_name;
     static const sstring index_version_option_name;
+    static const sstring included_columns_option_name;
 
 };
 
@@ -33,6 +33,23 @@ seastar::metrics::label ks{"ks"};
 
 namespace secondary_index {
 
+std::vector<sstring> included_columns(const index_options_map& options) {
+    auto it = options.find(db::index::secondary_index::included_columns_option_name);
+    if (it == options.end()) {
+        return {};
+    }
+    std::vector<sstring> columns;
+    for (auto&& name : it->second | std::views::split(',')) {
+        std::string_view sv(name.begin(), name.end());
+        const auto begin = sv.find_first_not_of(' ');
+        if (begin == std::string_view::npos) {
+            continue;
+        }
+        columns.emplace_back(sv.substr(begin, sv.find_last_not_of(' ') - begin + 1));
+    }
+    return columns;
+}
+
 index::index(const sstring& target_column, const index_metadata& im)
     : _im{im}
     , _target_type{cql3::statements::index_target::from_target_string(target_column)}
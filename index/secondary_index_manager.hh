@@ -60,6 +60,11 @@ sstring get_available_index_name(
         const std::set<sstring>& existing_names,
         std::function<bool(std::string_view, std::string_view)> has_schema);
 
+/// Names of the regular base columns which a covering index stores in its
+/// view next to the keys, as listed (comma-separated) by the index's
+/// included_columns option. Empty if the option is not set.
+std::vector<sstring> included_columns(const index_options_map& options);
+
 class index {
     index_metadata _im;
     cql3::statements::index_target::target_type _target_type;
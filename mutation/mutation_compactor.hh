@@ -479,6 +479,14 @@ class compact_mutation_state {
         _validator(mutation_fragment_v2::kind::clustering_row, cr.position(), {});
         if (!sstable_compaction()) {
             _last_pos = cr.position();
+            if (_slice.has_clustering_filter() && !_slice.clustering_filter_matches(_schema, cr.key())) {
+                // Sources may have emitted only the key, see query::clustering_column_restriction.
+                // Hand it over as a dead row, so that the consumer bounds the work with its
+                // tombstone limit, the same way regardless of where the row was stored.
+                partition_is_not_empty(consumer);
+                _stop = consumer.consume(clustering_row(cr.key()), row_tombstone(), false);
+                return _stop;
+            }
         }
         auto current_tombstone = std::max(_partition_tombstone, _effective_tombstone);
         auto t = cr.tomb();
@@ -721,6 +721,12 @@ void write_counter_cell(RowWriter& w, const query::partition_slice& slice, ::ato
             .end_qr_cell();
 }
 
+static thread_local row::hash_stats row_hash_stats;
+
+const row::hash_stats& row::get_hash_stats() noexcept {
+    return row_hash_stats;
+}
+
 template<typename Hasher>
 void appending_hash<row>::operator()(Hasher& h, const row& cells, const schema& s, column_kind kind, const query::column_id_vector& columns, max_timestamp& max_ts) const {
     for (auto id : columns) {
@@ -739,6 +745,7 @@ void appending_hash<row>::operator()(Hasher& h, const row& cells, const schema&
                     Hasher cellh;
                     feed_hash(cellh, cell_and_hash->cell.as_atomic_cell(def), def);
                     feed_hash(h, cellh.finalize_uint64());
+                    ++row_hash_stats.computed;
                 }
             } else {
                 feed_hash(h, cell_and_hash->cell.as_atomic_cell(def), def);
@@ -753,6 +760,7 @@ void appending_hash<row>::operator()(Hasher& h, const row& cells, const schema&
                     Hasher cellh;
                     feed_hash(cellh, cm, def);
                     feed_hash(h, cellh.finalize_uint64());
+                    ++row_hash_stats.computed;
                 }
             } else {
                 feed_hash(h, cm, def);
@@ -770,11 +778,16 @@ cell_hash_opt row::cell_hash_for(column_id id) const {
 
 void row::prepare_hash(const schema& s, column_kind kind) const {
     // const to avoid removing const qualifiers on the read path
+    // Hashes prepared here are fed to the digest as cached ones, so this is
+    // where digest reads of the row cache are accounted.
     for_each_cell([&s, kind] (column_id id, const cell_and_hash& c_a_h) {
         if (!c_a_h.hash) {
             query::default_hasher cellh;
             feed_hash(cellh, c_a_h.cell, s.column_at(kind, id));
             c_a_h.hash = cell_hash{cellh.finalize_uint64()};
+            ++row_hash_stats.computed;
+        } else {
+            ++row_hash_stats.cached;
         }
     });
 }
@@ -227,6 +227,15 @@ class row {
     void prepare_hash(const schema& s, column_kind kind) const;
     void clear_hash() const;
 
+    // Counts hashing of cells for digests of query results on this shard.
+    // Hashes cached in cells of the row cache are reused by digest reads
+    // until the cell is overwritten, so their share is the digest work avoided.
+    struct hash_stats {
+        uint64_t cached = 0;
+        uint64_t computed = 0;
+    };
+    static const hash_stats& get_hash_stats() noexcept;
+
     bool is_live(const schema&, column_kind kind, tombstone tomb = tombstone(), gc_clock::time_point now = gc_clock::time_point::min()) const;
 
     class printer {
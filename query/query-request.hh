@@ -169,6 +169,37 @@ class specific_ranges {
     clustering_row_ranges _ranges;
 };
 
+// A single-column restriction on a clustering key column, coming from a
+// filtering (ALLOW FILTERING) query. Replicas evaluate it on the serialized
+// clustering key, before the rest of the row is read, and drop rows which
+// don't satisfy it. The coordinator still applies the full filter, so this
+// is only an optimization.
+//
+// Sources don't drop rejected rows themselves, as that would make the work
+// done by a page, and so the point where it is cut, depend on how the data
+// is spread across memtables, sstables and the cache. They emit them with
+// only the key, without reading the rest of the row, and the query compactor
+// drops the merged row, accounting for it like for a dead row, i.e. towards
+// the page's tombstone limit.
+// IN is represented as `eq` with multiple values.
+struct clustering_column_restriction {
+    enum class op : uint8_t {
+        eq,
+        lt,
+        lte,
+        gt,
+        gte,
+    };
+    // Position of the restricted column in the clustering key.
+    uint32_t column;
+    op oper;
+    std::vector<bytes> values;
+
+    bool is_satisfied_by(const abstract_type& type, managed_bytes_view value) const;
+};
+
+using clustering_filter = std::vector<clustering_column_restriction>;
+
 constexpr auto max_rows = std::numeric_limits<uint64_t>::max();
 constexpr auto partition_max_rows = std::numeric_limits<uint64_t>::max();
 constexpr auto max_rows_if_set = std::numeric_limits<uint32_t>::max();
@@ -235,13 +266,17 @@ class partition_slice {
     std::unique_ptr<specific_ranges> _specific_ranges;
     uint32_t _partition_row_limit_low_bits;
     uint32_t _partition_row_limit_high_bits;
+    query::clustering_filter _clustering_filter;
+    // Local to this node, never serialized.
+    bool _allow_column_projection = false;
 public:
     partition_slice(clustering_row_ranges row_ranges, column_id_vector static_columns,
         column_id_vector regular_columns, option_set options,
         std::unique_ptr<specific_ranges> specific_ranges,
         cql_serialization_format,
         uint32_t partition_row_limit_low_bits,
-        uint32_t partition_row_limit_high_bits);
+        uint32_t partition_row_limit_high_bits,
+        query::clustering_filter clustering_filter = {});
     partition_slice(clustering_row_ranges row_ranges, column_id_vector static_columns,
         column_id_vector regular_columns, option_set options,
         std::unique_ptr<specific_ranges> specific_ranges = nullptr,
@@ -290,6 +325,31 @@ class partition_slice {
         return options.contains<query::partition_slice::option::reversed>();
     }
 
+    const query::clustering_filter& clustering_filter() const {
+        return _clustering_filter;
+    }
+    void set_clustering_filter(query::clustering_filter filter) {
+        _clustering_filter = std::move(filter);
+    }
+    bool has_clustering_filter() const {
+        return !_clustering_filter.empty();
+    }
+    // Returns false if a clustering row with the given key is known to be
+    // rejected by the clustering filter.
+    bool clustering_filter_matches(const schema& s, const clustering_key_prefix& key) const;
+
+    // When set, sstable readers may avoid materializing the values of cells
+    // belonging to columns which are not selected by this slice. Such cells
+    // are still emitted, with their timestamp, expiry and liveness intact, but
+    // with an empty value. Only safe for reads whose output is restricted to
+    // the selected columns and which don't populate the cache.
+    bool allow_column_projection() const {
+        return _allow_column_projection;
+    }
+    void set_allow_column_projection(bool allow) {
+        _allow_column_projection = allow;
+    }
+
     friend std::ostream& operator<<(std::ostream& out, const partition_slice& ps);
     friend std::ostream& operator<<(std::ostream& out, const specific_ranges& ps);
 };
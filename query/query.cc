@@ -50,8 +50,13 @@ std::ostream& operator<<(std::ostream& out, const partition_slice& ps) {
         fmt::print(out, ", specific=[{}]", *ps._specific_ranges);
     }
     // FIXME: pretty print options
-    fmt::print(out, ", options={:x}, , partition_row_limit={}}}",
+    fmt::print(out, ", options={:x}, , partition_row_limit={}",
                ps.options.mask(), ps.partition_row_limit());
+    if (!ps._clustering_filter.empty()) {
+        fmt::print(out, ", clustering_filter_columns=[{}]",
+                   fmt::join(ps._clustering_filter | std::views::transform(std::mem_fn(&clustering_column_restriction::column)), ", "));
+    }
+    fmt::print(out, "}}");
     return out;
 }
 
@@ -181,7 +186,8 @@ partition_slice::partition_slice(clustering_row_ranges row_ranges,
     std::unique_ptr<specific_ranges> specific_ranges,
     cql_serialization_format cql_format,
     uint32_t partition_row_limit_low_bits,
-    uint32_t partition_row_limit_high_bits)
+    uint32_t partition_row_limit_high_bits,
+    query::clustering_filter clustering_filter)
     : _row_ranges(std::move(row_ranges))
     , static_columns(std::move(static_columns))
     , regular_columns(std::move(regular_columns))
@@ -189,6 +195,7 @@ partition_slice::partition_slice(clustering_row_ranges row_ranges,
     , _specific_ranges(std::move(specific_ranges))
     , _partition_row_limit_low_bits(partition_row_limit_low_bits)
     , _partition_row_limit_high_bits(partition_row_limit_high_bits)
+    , _clustering_filter(std::move(clustering_filter))
 {
     cql_format.ensure_supported();
 }
@@ -232,11 +239,52 @@ partition_slice::partition_slice(const partition_slice& s)
     , _specific_ranges(s._specific_ranges ? std::make_unique<specific_ranges>(*s._specific_ranges) : nullptr)
     , _partition_row_limit_low_bits(s._partition_row_limit_low_bits)
     , _partition_row_limit_high_bits(s._partition_row_limit_high_bits)
+    , _clustering_filter(s._clustering_filter)
+    , _allow_column_projection(s._allow_column_projection)
 {}
 
 partition_slice::~partition_slice()
 {}
 
+bool clustering_column_restriction::is_satisfied_by(const abstract_type& type, managed_bytes_view value) const {
+    switch (oper) {
+    case op::eq:
+        return std::ranges::any_of(values, [&] (const bytes& v) { return type.equal(value, v); });
+    case op::lt:
+        return type.compare(value, values.front()) < 0;
+    case op::lte:
+        return type.compare(value, values.front()) <= 0;
+    case op::gt:
+        return type.compare(value, values.front()) > 0;
+    case op::gte:
+        return type.compare(value, values.front()) >= 0;
+    }
+    std::abort();
+}
+
+bool partition_slice::clustering_filter_matches(const schema& s, const clustering_key_prefix& key) const {
+    if (_clustering_filter.empty()) {
+        return true;
+    }
+    // Restrictions are sorted by column position.
+    auto r = _clustering_filter.begin();
+    uint32_t pos = 0;
+    for (managed_bytes_view component : key.components(s)) {
+        for (; r != _clustering_filter.end() && r->column == pos; ++r) {
+            if (!r->is_satisfied_by(s.clustering_column_at(pos).type->without_reversed(), component)) {
+                return false;
+            }
+        }
+        if (r == _clustering_filter.end()) {
+            return true;
+        }
+        ++pos;
+    }
+    // A restricted component is missing from the key, it can't satisfy
+    // the restriction (the coordinator sees it as null).
+    return false;
+}
+
 const clustering_row_ranges& partition_slice::row_ranges(const schema& s, const partition_key& k) const {
     auto* r = _specific_ranges ? _specific_ranges->range_for(s, k) : nullptr;
     return r ? *r : _row_ranges;
@@ -68,6 +68,7 @@
 #include "db/large_data_handler.hh"
 #include "db/corrupt_data_handler.hh"
 #include "db/data_listeners.hh"
+#include "replica/read_coalescer.hh"
 
 #include "data_dictionary/user_types_metadata.hh"
 #include <seastar/core/shared_ptr_incomplete.hh>
@@ -473,6 +474,9 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     , _system_sstables_manager(std::make_unique<sstables::sstables_manager>("system", *_nop_large_data_handler, *_nop_corrupt_data_handler, configure_sstables_manager(_cfg, dbcfg), feat, _row_cache_tracker, sst_dir_sem, [&stm]{ return stm.get()->get_my_id(); }, scf, abort, _cfg.extensions().sstable_file_io_extensions(), dbcfg.maintenance_scheduling_group))
     , _result_memory_limiter(dbcfg.available_memory / 10)
     , _data_listeners(std::make_unique<db::data_listeners>())
+    , _hot_partitions(std::make_unique<db::hot_partitions_tracker>(db::hot_partitions_tracker::config{
+            .sample_period = _cfg.hot_partitions_sample_period}))
+    , _read_coalescer(std::make_unique<read_coalescer>())
     , _mnotifier(mn)
     , _feat(feat)
     , _shared_token_metadata(stm)
@@ -494,6 +498,11 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
 
     _row_cache_tracker.set_compaction_scheduling_group(dbcfg.memory_compaction_scheduling_group);
 
+    _compaction_manager.set_flush_pressure_source([this, soft_limit = float(_cfg.unspooled_dirty_soft_limit())] {
+        auto dirty = _dirty_memory_manager.unspooled_dirty_memory() / float(_dirty_memory_manager.throttle_threshold());
+        return soft_limit < 1.0f ? (dirty - soft_limit) / (1.0f - soft_limit) : 0.0f;
+    });
+
     setup_scylla_memory_diagnostics_producer();
 }
 
@@ -586,6 +595,37 @@ void compaction_controller::set_max_shares(float max_shares) {
     _control_points.back().output = max_shares;
 }
 
+float compaction_controller::read_amplification_boost(float observed, float target, float flush_pressure) {
+    if (target <= 0 || observed <= target) {
+        return 1.0f;
+    }
+    float boost = std::min(observed / target, max_read_amplification_boost);
+    flush_pressure = std::clamp(flush_pressure, 0.0f, 1.0f);
+    return 1.0f + (boost - 1.0f) * (1.0f - flush_pressure);
+}
+
+int64_t compaction_controller::interval_percentile(const utils::estimated_histogram& h, const std::vector<int64_t>& previous, double perc, int64_t min_count) {
+    const auto& buckets = h.get_buckets();
+    const auto& offsets = h.get_bucket_offsets();
+    int64_t count = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        count += buckets[i] - previous[i];
+    }
+    if (count < min_count) {
+        return 0;
+    }
+    auto pcount = int64_t(std::floor(count * perc));
+    int64_t elements = 0;
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        elements += buckets[i] - previous[i];
+        if (elements >= pcount) {
+            return offsets[i];
+        }
+    }
+    // overflowed value is in the requested percentile
+    return offsets.back();
+}
+
 namespace replica {
 
 static const metrics::label class_label("class");
@@ -680,6 +720,23 @@ database::setup_metrics() {
         sm::make_counter("total_reads_rate_limited", _stats->total_reads_rate_limited,
                        sm::description("Counts read operations which were rejected on the replica side because the per-partition limit was reached.")),
 
+        sm::make_counter("coalesced_reads", [this] { return _read_coalescer->get_stats().coalesced; },
+                       sm::description("Counts single-partition reads which waited for an identical read in progress to share its result, "
+                                       "see replica_read_coalescing.")),
+
+        sm::make_counter("coalescing_reads", [this] { return _read_coalescer->get_stats().leaders; },
+                       sm::description("Counts single-partition reads which executed while offering to share their result with identical reads.")),
+
+        sm::make_counter("coalesced_reads_failed", [this] { return _read_coalescer->get_stats().fallbacks; },
+                       sm::description("Counts coalesced reads which executed on their own because the read sharing its result failed.")),
+
+        sm::make_counter("digest_cell_hashes_cached", [] { return ::row::get_hash_stats().cached; },
+                       sm::description("Counts cell hashes which digest reads took from the row cache instead of hashing the cell. "
+                                       "Its share of the sum with digest_cell_hashes_computed is the digest work avoided.")),
+
+        sm::make_counter("digest_cell_hashes_computed", [] { return ::row::get_hash_stats().computed; },
+                       sm::description("Counts cells hashed for digest reads.")),
+
         sm::make_current_bytes("view_update_backlog", [this] { return get_view_update_backlog().get_current_bytes(); },
                        sm::description("Holds the current size in bytes of the pending view updates for all tables"))(basic_level),
 
@@ -689,6 +746,10 @@ database::setup_metrics() {
         sm::make_counter("querier_cache_misses", _querier_cache.get_stats().misses,
                        sm::description("Counts querier cache lookups that failed to find a cached querier")),
 
+        sm::make_counter("querier_cache_hits", _querier_cache.get_stats().hits,
+                       sm::description("Counts querier cache lookups that found a cached querier and resumed the read with it. "
+                                       "Its share of querier_cache_lookups is the hit rate of paged reads.")),
+
         sm::make_counter("querier_cache_drops", _querier_cache.get_stats().drops,
                        sm::description("Counts querier cache lookups that found a cached querier but had to drop it")),
 
@@ -786,6 +847,7 @@ database::setup_metrics() {
 }
 
 database::~database() {
+    _compaction_manager.set_flush_pressure_source({});
     _user_types->deactivate();
     local_schema_registry().clear();
 }
@@ -1647,6 +1709,7 @@ keyspace::make_column_family_config(const schema& s, const database& db) const {
     cfg.data_listeners = &db.data_listeners();
     cfg.enable_compacting_data_for_streaming_and_repair = db_config.enable_compacting_data_for_streaming_and_repair;
     cfg.enable_tombstone_gc_for_streaming_and_repair = db_config.enable_tombstone_gc_for_streaming_and_repair;
+    cfg.memtable_flush_max_parallel_writers = db_config.memtable_flush_max_parallel_writers;
     cfg.guardrail_config = db::guardrail_config{
         .partition_size_fail_threshold_mb = db_config.large_partition_fail_threshold_mb,
         .partition_size_warn_threshold_mb = db_config.compaction_large_partition_warning_threshold_mb,
@@ -1879,6 +1942,34 @@ database::query(schema_ptr query_schema, const query::read_command& cmd, query::
         querier_opt = _querier_cache.lookup_data_querier(cmd.query_uuid, *query_schema, ranges.front(), cmd.slice, semaphore, trace_state, timeout);
     }
 
+    // Reads resuming a saved querier continue from where their previous page
+    // stopped, so they are never identical to another read.
+    std::optional<read_coalescer::leader> coalescing_leader;
+    if (!querier_opt && _cfg.replica_read_coalescing()) {
+        if (auto key = read_coalescer::make_key(cmd, opts, ranges, max_result_size)) {
+            if (auto wait = _read_coalescer->wait(*key, timeout)) {
+                auto f = co_await coroutine::as_future(std::move(*wait));
+                if (!f.failed()) {
+                    tracing::trace(trace_state, "Sharing the result of an identical read in progress");
+                    result = f.get();
+                    _stats->short_data_queries += bool(result->is_short_read());
+                    _hot_partitions->on_read(cf.schema(), ranges, result->buf().size());
+                    co_return std::tuple(std::move(result), cf.get_global_cache_hit_rate());
+                }
+                ex = f.get_exception();
+                if (try_catch<seastar::timed_out_error>(ex)) {
+                    co_return coroutine::exception(std::move(ex));
+                }
+                // The shared read failed, possibly for its own reasons, like
+                // an earlier timeout. Execute this one on its own.
+                ex = nullptr;
+                _read_coalescer->on_fallback();
+            } else if (auto leader = _read_coalescer->lead(std::move(*key))) {
+                coalescing_leader.emplace(std::move(*leader));
+            }
+        }
+    }
+
     auto read_func = [&, this] (reader_permit permit) {
         reader_permit::need_cpu_guard ncpu_guard{permit};
         permit.set_max_result_size(max_result_size);
@@ -1923,6 +2014,10 @@ database::query(schema_ptr query_schema, const query::read_command& cmd, query::
     auto hit_rate = cf.get_global_cache_hit_rate();
     ++semaphore.get_stats().total_successful_reads;
     _stats->short_data_queries += bool(result->is_short_read());
+    _hot_partitions->on_read(cf.schema(), ranges, result->buf().size());
+    if (coalescing_leader) {
+        coalescing_leader->resolve(result);
+    }
     co_return std::tuple(std::move(result), hit_rate);
 }
 
@@ -1989,9 +2084,39 @@ database::query_mutations(schema_ptr query_schema, const query::read_command& cm
     auto hit_rate = cf.get_global_cache_hit_rate();
     ++semaphore.get_stats().total_successful_reads;
     _stats->short_mutation_queries += bool(result.is_short_read());
+    _hot_partitions->on_read(cf.schema(), std::span(&range, 1), result.memory_usage());
     co_return std::tuple(std::move(result), hit_rate);
 }
 
+future<>
+database::consume_live_rows(schema_ptr query_schema, const query::read_command& cmd, const dht::partition_range_vector& ranges,
+                            live_row_consumer& consumer, tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout) {
+    column_family& cf = find_column_family(cmd.cf_id);
+    auto& semaphore = get_reader_concurrency_semaphore();
+    std::exception_ptr ex;
+
+    auto read_func = [&] (reader_permit permit) {
+        reader_permit::need_cpu_guard ncpu_guard{permit};
+        return cf.consume_live_rows(query_schema, std::move(permit), cmd, ranges, consumer, trace_state, timeout)
+                .finally([ncpu_guard = std::move(ncpu_guard)] { });
+    };
+
+    try {
+        auto op = cf.read_in_progress();
+        reader_permit_opt permit_holder;
+        co_await semaphore.with_permit(query_schema, "live-rows-query", cf.estimate_read_memory_cost(), timeout,
+                trace_state, permit_holder, read_func);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+
+    if (ex) {
+        ++semaphore.get_stats().total_failed_reads;
+        co_return coroutine::exception(std::move(ex));
+    }
+    ++semaphore.get_stats().total_successful_reads;
+}
+
 query::max_result_size database::get_query_max_result_size() const {
     switch (classify_request(_dbcfg)) {
         case request_class::user:
@@ -2198,33 +2323,54 @@ std::vector<replica::shared_memtable> memtable_list::clear_and_add() {
     return std::exchange(_memtables, std::move(new_memtables));
 }
 
+// Frozen mutations larger than this are unfrozen gently before being applied,
+// smaller ones are applied directly from their serialized form.
+static constexpr size_t max_frozen_mutation_size_for_direct_apply = 128*1024;
+
 future<> database::apply_in_memory(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h,
                                      db::timeout_clock::time_point timeout,
                                      shared_ptr<db::large_data_guardrail_base> guardrails, db::large_data_violation_type* violations_out) {
     auto& cf = find_column_family(m.column_family_id());
 
     data_listeners().on_write(m_schema, m);
+    _hot_partitions->on_write(m_schema, m);
+    const auto token = m.token(*m_schema);
 
-    if (m.representation().size() > 128*1024) {
+    if (m.representation().size() > max_frozen_mutation_size_for_direct_apply) {
         // Big mutation: unfreeze_gently (yields), then check guardrails on
         // the already-deserialized mutation before applying.
         auto pk = m.key();
-        return unfreeze_gently(m, std::move(m_schema)).then(
+        return end_read_coalescing(unfreeze_gently(m, std::move(m_schema)).then(
                 [&cf, h = std::move(h), timeout, guardrails, pk, violations_out] (auto m) mutable {
             guardrails->check(*m.schema(), m.partition(), pk, violations_out);
             return do_with(std::move(m), [&cf, h = std::move(h), timeout] (auto& m) mutable {
                 return cf.apply(m, std::move(h), timeout);
             });
-        });
+        }), cf.schema()->id(), token);
     }
 
     // Small mutation: forward guardrails to memtable::apply which will check
     // after partition_builder deserializes — no redundant unfreeze.
-    return cf.apply(m, std::move(m_schema), std::move(h), timeout, std::move(guardrails), violations_out);
+    if (_cfg.memtable_write_batching()) {
+        return end_read_coalescing(cf.apply_coalesced(m, std::move(m_schema), std::move(h), timeout, std::move(guardrails), violations_out),
+                cf.schema()->id(), token);
+    }
+    return end_read_coalescing(cf.apply(m, std::move(m_schema), std::move(h), timeout, std::move(guardrails), violations_out),
+            cf.schema()->id(), token);
 }
 
 future<> database::apply_in_memory(const mutation& m, column_family& cf, db::rp_handle&& h, db::timeout_clock::time_point timeout) {
-    return cf.apply(m, std::move(h), timeout);
+    return end_read_coalescing(cf.apply(m, std::move(h), timeout), cf.schema()->id(), m.token());
+}
+
+future<> database::end_read_coalescing(future<> f, table_id table, dht::token token) {
+    if (f.available()) {
+        _read_coalescer->on_write(table, token);
+        return f;
+    }
+    return f.finally([this, table, token] {
+        _read_coalescer->on_write(table, token);
+    });
 }
 
 future<counter_update_guard> database::acquire_counter_locks(schema_ptr s, const frozen_mutation& fm, db::timeout_clock::time_point timeout, tracing::trace_state_ptr trace_state) {
@@ -2402,9 +2548,39 @@ future<> database::do_apply_many(const utils::chunked_vector<frozen_mutation>& m
 
     // FIXME: Memtable application is not atomic so reads may observe mutations partially applied until restart.
     auto noop = db::noop_large_data_guardrail::instance();
-    for (size_t i = 0; i < muts.size(); ++i) {
+    auto is_small = [] (const frozen_mutation& m) {
+        return m.representation().size() <= max_frozen_mutation_size_for_direct_apply;
+    };
+    for (size_t i = 0; i < muts.size();) {
         auto s = local_schema_registry().get(muts[i].schema_version());
-        co_await apply_in_memory(muts[i], s, std::move(handles[i]), timeout, noop);
+        // Runs of small mutations of the same schema version (hence of the
+        // same table) are applied to the memtable as a single batch.
+        auto end = i;
+        while (end < muts.size() && muts[end].schema_version() == s->version() && is_small(muts[end])) {
+            ++end;
+        }
+        if (end - i <= 1) {
+            co_await apply_in_memory(muts[i], s, std::move(handles[i]), timeout, noop);
+            ++i;
+            continue;
+        }
+        auto& cf = find_column_family(s);
+        std::vector<memtable::batch_entry> batch;
+        batch.reserve(end - i);
+        for (; i < end; ++i) {
+            data_listeners().on_write(s, muts[i]);
+            _hot_partitions->on_write(s, muts[i]);
+            batch.push_back(memtable::batch_entry{&muts[i], std::move(handles[i]), noop.get()});
+        }
+        co_await cf.apply(batch, s, timeout);
+        for (auto& e : batch) {
+            _read_coalescer->on_write(s->id(), e.mut->token(*s));
+        }
+        for (auto& e : batch) {
+            if (e.error) {
+                co_await coroutine::return_exception_ptr(e.error);
+            }
+        }
     }
 }
 
@@ -153,6 +153,7 @@ class config;
 class extensions;
 class rp_handle;
 class data_listeners;
+class hot_partitions_tracker;
 class schema_ctxt;
 class large_data_handler;
 class system_table_corrupt_data_handler;
@@ -191,6 +192,7 @@ struct compaction_reenablers_and_lock_holders {
 
 using shared_memtable = lw_shared_ptr<memtable>;
 class global_table_ptr;
+class read_coalescer;
 
 // We could just add all memtables, regardless of types, to a single list, and
 // then filter them out when we read them. Here's why I have chosen not to do
@@ -417,6 +419,8 @@ struct table_stats {
     int64_t memtable_partition_hits = 0;
     int64_t memtable_range_tombstone_reads = 0;
     int64_t memtable_row_tombstone_reads = 0;
+    /** Number of writes applied to memtables together with other writes, see table::apply_coalesced() */
+    int64_t memtable_coalesced_writes = 0;
     int64_t tablet_count = 0;
     mutation_application_stats memtable_app_stats;
     utils::timed_rate_moving_average_summary_and_histogram reads{256};
@@ -485,6 +489,7 @@ class table : public enable_lw_shared_from_this<table>
         unsigned x_log2_compaction_groups{0};
         utils::updateable_value<bool> enable_compacting_data_for_streaming_and_repair;
         utils::updateable_value<bool> enable_tombstone_gc_for_streaming_and_repair;
+        utils::updateable_value<uint32_t> memtable_flush_max_parallel_writers{1};
         db::guardrail_config guardrail_config;
     };
 
@@ -493,6 +498,12 @@ class table : public enable_lw_shared_from_this<table>
         cache_temperature rate;
         lowres_clock::time_point last_updated;
     };
+    // Smoothed latency of reads of this table sent to a replica, and its
+    // mean deviation, estimated like TCP round-trip time (RFC 6298).
+    struct replica_read_latency {
+        std::chrono::microseconds mean{0};
+        std::chrono::microseconds deviation{0};
+    };
 private:
     schema_ptr _schema;
     config _config;
@@ -507,6 +518,25 @@ class table : public enable_lw_shared_from_this<table>
 
     template<typename... Args>
     void do_apply(compaction_group& cg, db::rp_handle&&, Args&&... args);
+    void do_apply_batch(compaction_group& cg, std::span<memtable::batch_entry* const> batch, const schema_ptr& m_schema);
+
+    // Small writes queued by apply_coalesced(), applied to the memtable
+    // together once the task which opened the batch yields.
+    struct write_batch {
+        struct waiter {
+            shared_ptr<db::large_data_guardrail_base> guardrails;
+            promise<> done;
+        };
+        schema_ptr schema;
+        // Shared by all writes of the batch.
+        db::timeout_clock::time_point timeout;
+        size_t size = 0;
+        // waiters[i] belongs to entries[i].
+        std::vector<memtable::batch_entry> entries;
+        std::vector<waiter> waiters;
+    };
+    lw_shared_ptr<write_batch> _open_write_batch;
+    future<> apply_write_batch(lw_shared_ptr<write_batch> batch);
 
     lw_shared_ptr<memtable_list> make_memory_only_memtable_list();
     lw_shared_ptr<memtable_list> make_memtable_list(compaction_group& cg);
@@ -562,6 +592,10 @@ class table : public enable_lw_shared_from_this<table>
     // Labels used to identify writes and reads for this table in the rate_limiter structure.
     db::rate_limiter::label _rate_limiter_label_for_writes;
     db::rate_limiter::label _rate_limiter_label_for_reads;
+    // Counts the reads coordinated on this shard, used to detect hot partitions
+    // for the coordinator read cache. Kept separate from the replica labels so
+    // that it doesn't affect per-partition rate limiting.
+    db::rate_limiter::label _rate_limiter_label_for_coordinator_reads;
 
     void set_metrics();
     seastar::metrics::metric_groups _metrics;
@@ -575,6 +609,10 @@ class table : public enable_lw_shared_from_this<table>
     // in dynamically
     std::unordered_map<locator::host_id, cache_hit_rate> _cluster_cache_hit_rates;
 
+    // holds latencies of reads sent by this coordinator to each node,
+    // filled in only when adaptive speculative retry is enabled
+    std::unordered_map<locator::host_id, replica_read_latency> _replica_read_latencies;
+
     // Operations like truncate, flush, query, etc, may depend on a column family being alive to
     // complete.  Some of them have their own gate already (like flush), used in specialized wait
     // logic. That is particularly useful if there is a particular
@@ -817,6 +855,8 @@ class table : public enable_lw_shared_from_this<table>
     static void remove_sstable_from_backlog_tracker(compaction::compaction_backlog_tracker& tracker, sstables::shared_sstable sstable);
     lw_shared_ptr<memtable> new_memtable();
     future<> try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtable> memt, sstable_write_permit&& permit);
+    // Number of sstables to flush the memtable into concurrently.
+    unsigned flush_writers_for(const memtable& memt) const;
     // Caller must keep m alive.
     future<> update_cache(compaction_group& cg, lw_shared_ptr<memtable> m, std::vector<sstables::shared_sstable> ssts);
     struct merge_comparator;
@@ -1029,6 +1069,10 @@ class table : public enable_lw_shared_from_this<table>
         return _rate_limiter_label_for_reads;
     }
 
+    db::rate_limiter::label& get_rate_limiter_label_for_coordinator_reads() {
+        return _rate_limiter_label_for_coordinator_reads;
+    }
+
     future<std::vector<locked_cell>> lock_counter_cells(const mutation& m, db::timeout_clock::time_point timeout);
 
     logalloc::occupancy_stats occupancy() const;
@@ -1077,6 +1121,17 @@ class table : public enable_lw_shared_from_this<table>
     future<> apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h,
                    db::timeout_clock::time_point tmo, shared_ptr<db::large_data_guardrail_base> guardrails, db::large_data_violation_type* violations_out = nullptr);
     future<> apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::time_point tmo);
+    // Applies a batch of mutations of the same schema version. Mutations
+    // belonging to the same compaction group are applied to its memtable
+    // together, in chunks of bounded size. The returned future doesn't fail,
+    // every entry ends up either applied or with its error set. The entries,
+    // and what they point to, must be kept alive until it resolves.
+    future<> apply(std::span<memtable::batch_entry> batch, schema_ptr m_schema, db::timeout_clock::time_point tmo);
+    // Like apply() of a frozen mutation, but the mutation is applied to the
+    // memtable together with the other writes to this table issued before
+    // the current task yields. Meant for small mutations.
+    future<> apply_coalesced(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h,
+                   db::timeout_clock::time_point tmo, shared_ptr<db::large_data_guardrail_base> guardrails, db::large_data_violation_type* violations_out = nullptr);
 
     // Returns at most "cmd.limit" rows
     // The saved_querier parameter is an input-output parameter which contains
@@ -1094,6 +1149,18 @@ class table : public enable_lw_shared_from_this<table>
         db::timeout_clock::time_point timeout,
         std::optional<querier>* saved_querier = { });
 
+    // Hands the live rows selected by cmd over to the consumer, in pages of
+    // at most live_rows_page_size rows, checking the timeout between pages.
+    // The row and partition limits of cmd are not applied.
+    static constexpr uint64_t live_rows_page_size = 10000;
+    future<> consume_live_rows(schema_ptr query_schema,
+        reader_permit permit,
+        const query::read_command& cmd,
+        const dht::partition_range_vector& ranges,
+        live_row_consumer& consumer,
+        tracing::trace_state_ptr trace_state,
+        db::timeout_clock::time_point timeout);
+
     // Performs a query on given data source returning data in reconcilable form.
     //
     // Reads at most row_limit rows. If less rows are returned, the data source
@@ -1341,6 +1408,12 @@ class table : public enable_lw_shared_from_this<table>
     void add_coordinator_read_latency(utils::estimated_histogram::duration latency);
     std::chrono::milliseconds get_coordinator_read_latency_percentile(double percentile);
 
+    void add_replica_read_latency(locator::host_id addr, utils::estimated_histogram::duration latency);
+    // Returns the latency within which the replica is expected to respond to
+    // a read, or nullopt if no read was sent to it yet.
+    std::optional<std::chrono::microseconds> predict_replica_read_latency(locator::host_id addr) const;
+    void drop_replica_read_latency(locator::host_id addr);
+
     secondary_index::secondary_index_manager& get_index_manager() {
         return _index_manager;
     }
@@ -1792,6 +1865,8 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
 
     friend db::data_listeners;
     std::unique_ptr<db::data_listeners> _data_listeners;
+    std::unique_ptr<db::hot_partitions_tracker> _hot_partitions;
+    std::unique_ptr<read_coalescer> _read_coalescer;
 
     service::migration_notifier& _mnotifier;
     gms::feature_service& _feat;
@@ -1830,6 +1905,9 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
                                db::timeout_clock::time_point timeout,
                                 shared_ptr<db::large_data_guardrail_base> guardrails, db::large_data_violation_type* large_data_violation_out = nullptr);
     future<> apply_in_memory(const mutation& m, column_family& cf, db::rp_handle&&, db::timeout_clock::time_point timeout);
+    // Lets the read coalescer know once the write of the partition completes,
+    // see read_coalescer::on_write().
+    future<> end_read_coalescing(future<> f, table_id table, dht::token token);
 
     drain_progress get_drain_progress() const noexcept {
         return _drain_progress;
@@ -2035,6 +2113,11 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
                                                                   db::timeout_clock::time_point timeout, db::per_partition_rate_limit::info rate_limit_info = std::monostate{});
     future<std::tuple<reconcilable_result, cache_temperature>> query_mutations(schema_ptr query_schema, const query::read_command& cmd, const dht::partition_range& range,
                                                 tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout, bool tombstone_gc_enabled = true);
+    // Reads the ranges from this shard only, handing the live rows over to
+    // the consumer instead of building a query::result. See
+    // table::consume_live_rows().
+    future<> consume_live_rows(schema_ptr query_schema, const query::read_command& cmd, const dht::partition_range_vector& ranges,
+                               live_row_consumer& consumer, tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout);
     // Apply the mutation atomically.
     // Throws timed_out_error when timeout is reached.
     future<db::large_data_violation_type> apply(schema_ptr, const frozen_mutation&, tracing::trace_state_ptr tr_state, db::commitlog_force_sync sync, db::timeout_clock::time_point timeout, db::per_partition_rate_limit::info rate_limit_info = std::monostate{}, bool skip_large_data_guardrails = false);
@@ -2211,6 +2294,16 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
         return *_data_listeners;
     }
 
+    // Accounts a read of the partition with the given token coordinated on
+    // this shard, and returns the estimated recent rate of such reads.
+    uint64_t account_coordinator_read(table& t, dht::token token) noexcept {
+        return _rate_limiter.increase_and_get_counter(t.get_rate_limiter_label_for_coordinator_reads(), dht::token::to_int64(token));
+    }
+
+    db::hot_partitions_tracker& hot_partitions() const {
+        return *_hot_partitions;
+    }
+
     // Get the maximum result size for a query, appropriate for the
     // query class, which is deduced from the current scheduling group.
     query::max_result_size get_query_max_result_size() const;
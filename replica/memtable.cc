@@ -634,9 +634,9 @@ class flush_reader final : public mutation_reader::impl, private iterator_reader
     mutation_reader_opt _partition_reader;
     flush_memory_accounter _flushed_memory;
 public:
-    flush_reader(schema_ptr s, reader_permit permit, lw_shared_ptr<memtable> m)
+    flush_reader(schema_ptr s, reader_permit permit, lw_shared_ptr<memtable> m, const dht::partition_range& range)
         : impl(s, std::move(permit))
-        , iterator_reader(std::move(s), m, query::full_partition_range)
+        , iterator_reader(std::move(s), m, range)
         , _flushed_memory(*m)
     {}
     flush_reader(const flush_reader&) = delete;
@@ -753,15 +753,42 @@ memtable::make_mutation_reader_opt(schema_ptr query_schema,
 }
 
 mutation_reader
-memtable::make_flush_reader(schema_ptr s, reader_permit permit) {
+memtable::make_flush_reader(schema_ptr s, reader_permit permit, const dht::partition_range& range) {
     if (!_merged_into_cache) {
+        // Readers of all the ranges of a split flush are created before any of
+        // them starts reading, so reverting here doesn't lose accounted memory.
         revert_flushed_memory();
-        return make_mutation_reader<flush_reader>(std::move(s), std::move(permit), shared_from_this());
+        return make_mutation_reader<flush_reader>(std::move(s), std::move(permit), shared_from_this(), range);
     } else {
         auto& full_slice = s->full_slice();
         return make_mutation_reader<scanning_reader>(std::move(s), shared_from_this(), std::move(permit),
-                      query::full_partition_range, full_slice, mutation_reader::forwarding::no);
+                      range, full_slice, mutation_reader::forwarding::no);
+    }
+}
+
+std::vector<dht::partition_range>
+memtable::split_for_flush(unsigned n) const {
+    if (n <= 1 || nr_partitions < 2) {
+        return {query::full_partition_range};
+    }
+    auto last_it = partitions.end();
+    --last_it;
+    const uint64_t first = partitions.begin()->key().token().unbias();
+    const uint64_t last = last_it->key().token().unbias();
+    std::vector<dht::partition_range> ranges;
+    ranges.reserve(n);
+    std::optional<dht::partition_range::bound> start;
+    for (unsigned i = 1; i < n; ++i) {
+        auto split = dht::token::bias(first + uint64_t((unsigned __int128)(last - first) * i / n));
+        if (start && start->value().token() == split) {
+            continue;
+        }
+        auto end = dht::partition_range::bound(dht::ring_position::ending_at(split), true);
+        ranges.emplace_back(start, end);
+        start = dht::partition_range::bound(std::move(end.value()), false);
     }
+    ranges.emplace_back(std::move(start), std::nullopt);
+    return ranges;
 }
 
 void
@@ -816,6 +843,62 @@ memtable::apply(const frozen_mutation& m, const schema_ptr& m_schema,
     update(std::move(h));
 }
 
+void
+memtable::apply(std::span<batch_entry* const> batch, const schema_ptr& m_schema, db::large_data_guardrail_base& tracking) {
+    struct entry {
+        dht::decorated_key dk;
+        batch_entry* e;
+    };
+    // Applying in token order makes consecutive lookups walk mostly the same
+    // tree nodes.
+    auto order = batch | std::views::transform([this] (batch_entry* e) {
+        return entry{dht::decorate_key(*_schema, e->mut->key()), e};
+    }) | std::ranges::to<std::vector>();
+    std::ranges::sort(order, dht::ring_position_less_comparator(*_schema), &entry::dk);
+
+    size_t next = 0;
+    // Mutations which made it into the memtable must keep their replay
+    // positions even if a later one failed.
+    auto update_applied = [&, this] {
+        for (auto& [dk, e] : order | std::views::take(next)) {
+            if (e->applied) {
+                update(std::move(e->handle));
+            }
+        }
+    };
+    try {
+        with_allocator(allocator(), [&, this] {
+            _table_shared_data.batch_allocating_section(*this, [&, this] {
+                // The section is retried after an allocation failure, resume
+                // from the mutation which failed.
+                for (; next < order.size(); ++next) {
+                    auto& [dk, e] = order[next];
+                    mutation_partition mp(*m_schema);
+                    partition_builder pb(*m_schema, mp);
+                    e->mut->partition().accept(*m_schema, pb);
+                    try {
+                        e->guardrails->check(*m_schema, mp, dk.key(), e->violations_out);
+                    } catch (const std::bad_alloc&) {
+                        throw;
+                    } catch (...) {
+                        e->error = std::current_exception();
+                        continue;
+                    }
+                    auto& p = find_or_create_partition(dk);
+                    _stats_collector.update(*m_schema, mp);
+                    p.apply(region(), cleaner(), *_schema, mp, *m_schema, _table_stats.memtable_app_stats,
+                            tracking.get_memtable_cache_tracker(*m_schema, dk.key()));
+                    e->applied = true;
+                }
+            });
+        });
+    } catch (...) {
+        update_applied();
+        throw;
+    }
+    update_applied();
+}
+
 logalloc::occupancy_stats memtable::occupancy() const noexcept {
     return logalloc::region::occupancy();
 }
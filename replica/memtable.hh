@@ -9,6 +9,7 @@
 #pragma once
 
 #include <fmt/core.h>
+#include <span>
 #include "replica/database_fwd.hh"
 #include "dht/decorated_key.hh"
 #include "dht/ring_position.hh"
@@ -98,6 +99,9 @@ namespace replica {
 struct memtable_table_shared_data {
     logalloc::allocating_section read_section;
     logalloc::allocating_section allocating_section;
+    // Used by batched applies, so that the reserve they learn doesn't
+    // inflate the one of single mutation applies.
+    logalloc::allocating_section batch_allocating_section;
 };
 
 class dirty_memory_manager;
@@ -245,6 +249,23 @@ class memtable final
     void apply(const frozen_mutation& m, const schema_ptr& m_schema, db::rp_handle&& h = {}) {
         apply(m, m_schema, *db::noop_large_data_guardrail::instance(), nullptr, nullptr, std::move(h));
     }
+    // A mutation applied by the batch overload of apply().
+    struct batch_entry {
+        const frozen_mutation* mut;
+        db::rp_handle handle;
+        const db::large_data_guardrail_base* guardrails;
+        db::large_data_violation_type* violations_out = nullptr;
+        // Set by apply(): whether the mutation made it into the memtable,
+        // or the exception it was rejected with by its guardrails.
+        bool applied = false;
+        std::exception_ptr error;
+    };
+    // Applies a batch of mutations of the same schema in token order, within
+    // a single run of the allocating section. A mutation rejected by its
+    // guardrails fails alone, any other exception aborts the rest of the
+    // batch. Cache trackers are obtained from `tracking` as each mutation
+    // is applied.
+    void apply(std::span<batch_entry* const> batch, const schema_ptr& m_schema, db::large_data_guardrail_base& tracking);
     void evict_entry(memtable_entry& e, mutation_cleaner& cleaner) noexcept;
 
     static memtable& from_region(logalloc::region& r) noexcept {
@@ -329,7 +350,14 @@ class memtable final
         return make_mutation_reader(s, std::move(permit), range, full_slice);
     }
 
-    mutation_reader make_flush_reader(schema_ptr, reader_permit permit);
+    // The range must be alive as long as the reader is. Readers of disjoint
+    // ranges can flush the memtable concurrently, see split_for_flush().
+    mutation_reader make_flush_reader(schema_ptr, reader_permit permit, const dht::partition_range& range = query::full_partition_range);
+
+    // Splits the ring into at most n disjoint ranges, which have a similar
+    // number of this memtable's partitions assuming their tokens are uniformly
+    // distributed between the first and the last one.
+    std::vector<dht::partition_range> split_for_flush(unsigned n) const;
 
     mutation_source as_data_source();
 
@@ -355,6 +355,7 @@ std::optional<Querier> querier_cache::lookup_querier(
     const auto can_be_used = can_be_used_for_page(_is_user_semaphore_func, q, s, ranges.front(), slice, current_sem);
     if (can_be_used == can_use::yes) {
         tracing::trace(trace_state, "Reusing querier");
+        ++stats.hits;
         return std::optional<Querier>(std::move(q));
     }
 
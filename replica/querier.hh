@@ -50,6 +50,52 @@ auto consume_page(mutation_reader& reader,
     });
 }
 
+/// Consumes the live rows of a local read, see database::consume_live_rows().
+///
+/// The rows are compacted, as they are for building a query result, but
+/// handed over as they stream out of the querier, so callers which only fold
+/// them into some state don't need to build and parse a query::result.
+class live_row_consumer {
+public:
+    virtual ~live_row_consumer() = default;
+    virtual void consume_new_partition(const dht::decorated_key& dk) = 0;
+    virtual void consume(static_row&& sr) = 0;
+    virtual void consume(clustering_row&& cr) = 0;
+    virtual void consume_end_of_partition() = 0;
+};
+
+/// Adapts a live_row_consumer to the CompactedFragmentsConsumer concept,
+/// dropping everything which is not live.
+class live_row_consumer_adaptor {
+    live_row_consumer& _consumer;
+public:
+    explicit live_row_consumer_adaptor(live_row_consumer& consumer) noexcept : _consumer(consumer) { }
+    void consume_new_partition(const dht::decorated_key& dk) {
+        _consumer.consume_new_partition(dk);
+    }
+    void consume(tombstone) { }
+    stop_iteration consume(static_row&& sr, tombstone, bool is_alive) {
+        if (is_alive) {
+            _consumer.consume(std::move(sr));
+        }
+        return stop_iteration::no;
+    }
+    stop_iteration consume(clustering_row&& cr, row_tombstone, bool is_alive) {
+        if (is_alive) {
+            _consumer.consume(std::move(cr));
+        }
+        return stop_iteration::no;
+    }
+    stop_iteration consume(range_tombstone_change&&) {
+        return stop_iteration::no;
+    }
+    stop_iteration consume_end_of_partition() {
+        _consumer.consume_end_of_partition();
+        return stop_iteration::no;
+    }
+    void consume_end_of_stream() { }
+};
+
 class querier_base {
     friend class querier_utils;
 
@@ -305,6 +351,9 @@ class querier_cache {
         uint64_t lookups = 0;
         // The subset of lookups that missed.
         uint64_t misses = 0;
+        // The subset of lookups that found a querier which could be used to
+        // resume the read, i.e. the page saved a re-seek of the reader.
+        uint64_t hits = 0;
         // The subset of lookups that hit but the looked up querier had to be
         // dropped due to position mismatch.
         uint64_t drops = 0;
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include <cstring>
+
+#include "replica/read_coalescer.hh"
+#include "dht/ring_position.hh"
+#include "idl/read_command.dist.hh"
+#include "idl/read_command.dist.impl.hh"
+
+namespace replica {
+
+read_coalescer::leader::~leader() {
+    if (!_coalescer) {
+        return;
+    }
+    _coalescer->erase(_key, _promise);
+    _promise->set_exception(std::make_exception_ptr(std::runtime_error("coalesced read failed")));
+}
+
+void read_coalescer::leader::resolve(result_ptr result) noexcept {
+    // Reads arriving from now on must not be served this result, which may
+    // precede their writes.
+    std::exchange(_coalescer, nullptr)->erase(_key, _promise);
+    _promise->set_value(std::move(result));
+}
+
+void read_coalescer::erase(const bytes& key, const lw_shared_ptr<promise_type>& promise) noexcept {
+    // The read may have been superseded by a later one, after a write.
+    auto it = _inflight.find(key);
+    if (it != _inflight.end() && it->second.promise == promise) {
+        _inflight.erase(it);
+    }
+}
+
+std::optional<read_coalescer::read_key> read_coalescer::make_key(const query::read_command& cmd, const query::result_options& opts,
+        const dht::partition_range_vector& ranges, const query::max_result_size& max_result_size) {
+    if (ranges.size() != 1 || !ranges.front().is_singular() || !ranges.front().start()->value().has_key()) {
+        return std::nullopt;
+    }
+    const auto& pos = ranges.front().start()->value();
+    const auto pk = to_bytes(pos.key()->representation());
+
+    const int64_t fields[] = {
+        cmd.cf_id.uuid().get_most_significant_bits(),
+        cmd.cf_id.uuid().get_least_significant_bits(),
+        cmd.schema_version.uuid().get_most_significant_bits(),
+        cmd.schema_version.uuid().get_least_significant_bits(),
+        int64_t(cmd.get_row_limit()),
+        int64_t(cmd.partition_limit),
+        cmd.timestamp.time_since_epoch().count(),
+        int64_t(max_result_size.soft_limit),
+        int64_t(max_result_size.hard_limit),
+        int64_t(max_result_size.get_page_size()),
+        int64_t(cmd.tombstone_limit),
+        int64_t(opts.request),
+        int64_t(opts.digest_algo),
+    };
+    // The slice is serialized after the fields and the key, with a size
+    // prefix, so keys of different reads cannot collide.
+    auto key = ser::serialize_to_buffer<bytes>(cmd.slice, sizeof(fields) + pk.size());
+    std::memcpy(key.begin(), fields, sizeof(fields));
+    std::memcpy(key.begin() + sizeof(fields), pk.begin(), pk.size());
+    return read_key{std::move(key), cmd.cf_id, pos.token()};
+}
+
+std::optional<future<read_coalescer::result_ptr>> read_coalescer::wait(const read_key& key, db::timeout_clock::time_point timeout) {
+    auto it = _inflight.find(key.data);
+    if (it == _inflight.end()) {
+        return std::nullopt;
+    }
+    if (it->second.write_epoch != write_epoch(key.table, key.token)) {
+        // The read in flight may have missed a write which this one must
+        // see. Let this one take its place.
+        _inflight.erase(it);
+        return std::nullopt;
+    }
+    ++_stats.coalesced;
+    return it->second.promise->get_shared_future(timeout).then([] (result_ptr result) {
+        // Every reader gets its own result, as it may be handed over to
+        // another shard.
+        return make_lw_shared<query::result>(bytes_ostream(result->buf()), result->digest(), result->last_modified(),
+                result->is_short_read(), result->row_count_low_bits(), result->partition_count(), result->row_count_high_bits(),
+                result->last_position());
+    });
+}
+
+std::optional<read_coalescer::leader> read_coalescer::lead(read_key key) {
+    if (_inflight.size() >= max_inflight_reads) {
+        return std::nullopt;
+    }
+    auto promise = make_lw_shared<promise_type>();
+    auto [it, inserted] = _inflight.emplace(key.data, inflight_read{promise, write_epoch(key.table, key.token)});
+    if (!inserted) {
+        return std::nullopt;
+    }
+    ++_stats.leaders;
+    return leader(*this, std::move(key.data), std::move(promise));
+}
+
+} // namespace replica
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include "bytes.hh"
+#include "db/timeout_clock.hh"
+#include "dht/i_partitioner_fwd.hh"
+#include "dht/token.hh"
+#include "query/query-request.hh"
+#include "query/query-result.hh"
+
+namespace replica {
+
+// Lets identical single-partition reads, executing concurrently on a shard,
+// share the result of one of them, instead of each walking the same cache
+// and sstables. The first read of a kind registers as the leader, reads
+// arriving while it executes wait for its result and get a copy of it.
+//
+// Only reads in flight are shared, and a read is not shared once a write of
+// its partition completes, so this never serves a result older than the read
+// it is served to, which would break reading one's own writes. Waiting reads
+// keep their own timeout. If the leader fails, e.g. because its own timeout
+// was shorter, they execute on their own.
+class read_coalescer {
+public:
+    using result_ptr = lw_shared_ptr<query::result>;
+
+    // Bounds the memory used by keys of reads in flight.
+    static constexpr size_t max_inflight_reads = 1024;
+
+    struct stats {
+        uint64_t leaders = 0;
+        uint64_t coalesced = 0;
+        uint64_t fallbacks = 0;
+    };
+
+    struct read_key {
+        // Identifies the read among the reads in flight.
+        bytes data;
+        table_id table;
+        dht::token token;
+    };
+
+private:
+    using promise_type = shared_promise<with_clock<db::timeout_clock>, result_ptr>;
+
+    struct inflight_read {
+        lw_shared_ptr<promise_type> promise;
+        // The write epoch of the partition when the read started.
+        uint64_t write_epoch;
+    };
+
+    // Completed writes, counted per partition, hashed into a fixed number of
+    // buckets. A read started before a write of its partition completed is
+    // no longer shared. Writes of other partitions in the same bucket may end
+    // sharing too, which is only a missed optimization.
+    static constexpr size_t write_epoch_buckets = 1024;
+
+    std::unordered_map<bytes, inflight_read> _inflight;
+    std::array<uint64_t, write_epoch_buckets> _write_epochs = {};
+    stats _stats;
+
+    uint64_t& write_epoch(table_id table, dht::token token) noexcept {
+        return _write_epochs[(std::hash<table_id>()(table) ^ std::hash<dht::token>()(token)) % write_epoch_buckets];
+    }
+    void erase(const bytes& key, const lw_shared_ptr<promise_type>& promise) noexcept;
+
+public:
+    // Registration of the read whose result is shared. Unless resolve() is
+    // called, fails the waiting reads when destroyed.
+    class leader {
+        read_coalescer* _coalescer;
+        bytes _key;
+        lw_shared_ptr<promise_type> _promise;
+    public:
+        leader(read_coalescer& coalescer, bytes key, lw_shared_ptr<promise_type> promise) noexcept
+            : _coalescer(&coalescer), _key(std::move(key)), _promise(std::move(promise)) { }
+        leader(leader&& o) noexcept
+            : _coalescer(std::exchange(o._coalescer, nullptr)), _key(std::move(o._key)), _promise(std::move(o._promise)) { }
+        leader& operator=(leader&&) = delete;
+        ~leader();
+
+        void resolve(result_ptr result) noexcept;
+    };
+
+    // Returns the key identifying the read among the reads in flight,
+    // or nullopt if the read is not a single-partition one.
+    static std::optional<read_key> make_key(const query::read_command& cmd, const query::result_options& opts,
+            const dht::partition_range_vector& ranges, const query::max_result_size& max_result_size);
+
+    // If an identical read is in flight, returns a copy of its result, which
+    // fails with seastar::timed_out_error on timeout, or with the leader's
+    // error if the leader failed. Otherwise, or if a write of the partition
+    // completed since the identical read started, returns nullopt.
+    std::optional<future<result_ptr>> wait(const read_key& key, db::timeout_clock::time_point timeout);
+
+    // Registers the read as the one whose result is shared with identical
+    // reads. It must create its reader only after this returns. Returns
+    // nullopt if too many reads are in flight.
+    std::optional<leader> lead(read_key key);
+
+    // Called once a write of the partition completes, so that reads which
+    // started before it are not shared with reads starting after it.
+    void on_write(table_id table, dht::token token) noexcept {
+        ++write_epoch(table, token);
+    }
+
+    void on_fallback() noexcept {
+        ++_stats.fallbacks;
+    }
+
+    const stats& get_stats() const noexcept {
+        return _stats;
+    }
+};
+
+} // namespace replica
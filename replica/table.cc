@@ -10,6 +10,7 @@
 #include <seastar/core/shard_id.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/with_scheduling_group.hh>
+#include <seastar/core/later.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/coroutine/exception.hh>
 #include <seastar/coroutine/parallel_for_each.hh>
@@ -2076,6 +2077,13 @@ table::seal_active_memtable(compaction_group& cg, flush_permit&& flush_permit) n
     // FIXME: provide back-pressure to upper layers
 }
 
+unsigned
+table::flush_writers_for(const memtable& memt) const {
+    static constexpr size_t memtable_bytes_per_flush_writer = 128 * 1024 * 1024;
+    const unsigned max_writers = std::max(1u, _config.memtable_flush_max_parallel_writers());
+    return std::clamp<size_t>(memt.occupancy().used_space() / memtable_bytes_per_flush_writer, 1, max_writers);
+}
+
 future<>
 table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtable> old, sstable_write_permit&& permit_) {
     co_await utils::get_local_injector().inject("flush_memtable_to_sstable_wait", utils::wait_for_message(60s));
@@ -2104,11 +2112,25 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
         co_await _compaction_manager.maybe_wait_for_sstable_count_reduction(cg.view_for_unrepaired_data());
     }
 
-    auto consumer = _compaction_strategy.make_interposer_consumer(metadata, [this, old, permit, &newtabs, estimated_partitions, &cg] (mutation_reader reader) mutable -> future<> {
+    // Large memtables are split into disjoint token ranges, flushed concurrently
+    // into sstables of a single run. Not done when the compaction strategy splits
+    // the flushed data by itself, as the output wouldn't form a run then.
+    auto flush_ranges = old->split_for_flush(_compaction_strategy.use_interposer_consumer() ? 1 : flush_writers_for(*old));
+    auto run_identifier = sstables::run_id::create_random_id();
+    if (flush_ranges.size() > 1) {
+        tlogger.debug("Flushing memtable of {}.{} with {} writers", _schema->ks_name(), _schema->cf_name(), flush_ranges.size());
+        estimated_partitions = std::max<uint64_t>(1, estimated_partitions / flush_ranges.size());
+    }
+
+    auto consumer = _compaction_strategy.make_interposer_consumer(metadata, [this, old, permit, &newtabs, estimated_partitions, &cg,
+            split = flush_ranges.size() > 1, run_identifier] (mutation_reader reader) mutable -> future<> {
       std::exception_ptr ex;
       try {
         sstables::sstable_writer_config cfg = get_sstables_manager().configure_writer("memtable");
         cfg.backup = incremental_backups_enabled();
+        if (split) {
+            cfg.run_identifier = run_identifier;
+        }
 
         auto newtab = make_sstable();
         newtabs.push_back(newtab);
@@ -2125,9 +2147,21 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
       co_await coroutine::return_exception_ptr(std::move(ex));
     });
 
-    auto f = consumer(old->make_flush_reader(
-        old->schema(),
-        compaction_concurrency_semaphore().make_tracking_only_permit(old->schema(), "try_flush_memtable_to_sstable()", db::no_timeout, {})));
+    // All flush readers are created before any of them starts reading, see make_flush_reader().
+    std::vector<mutation_reader> readers;
+    readers.reserve(flush_ranges.size());
+    for (const auto& range : flush_ranges) {
+        readers.push_back(old->make_flush_reader(
+            old->schema(),
+            compaction_concurrency_semaphore().make_tracking_only_permit(old->schema(), "try_flush_memtable_to_sstable()", db::no_timeout, {}),
+            range));
+    }
+    std::vector<future<>> writes;
+    writes.reserve(readers.size());
+    for (auto& reader : readers) {
+        writes.push_back(consumer(std::move(reader)));
+    }
+    auto f = when_all_succeed(writes.begin(), writes.end());
 
     // Switch back to default scheduling group for post-flush actions, to avoid them being staved by the memtable flush
     // controller. Cache update does not affect the input of the memtable cpu controller, so it can be subject to
@@ -2230,6 +2264,7 @@ void table::set_metrics() {
                 ms::make_counter("memtable_rows_compacted_with_tombstones", _stats.memtable_app_stats.rows_compacted_with_tombstones, ms::description("Number of rows scanned during write of a tombstone for the purpose of compaction in memtables"))(cf)(ks).set_skip_when_empty(),
                 ms::make_counter("memtable_range_tombstone_reads", _stats.memtable_range_tombstone_reads, ms::description("Number of range tombstones read from memtables"))(cf)(ks).set_skip_when_empty(),
                 ms::make_counter("memtable_row_tombstone_reads", _stats.memtable_row_tombstone_reads, ms::description("Number of row tombstones read from memtables"))(cf)(ks),
+                ms::make_counter("memtable_coalesced_writes", _stats.memtable_coalesced_writes, ms::description("Number of writes applied to memtables together with other writes"))(cf)(ks).set_skip_when_empty(),
                 ms::make_gauge("pending_tasks", ms::description("Estimated number of tasks pending for this column family"), _stats.pending_flushes)(cf)(ks),
                 ms::make_gauge("live_disk_space", ms::description("Live disk space used"), _stats.live_disk_space_used.on_disk)(cf)(ks),
                 ms::make_gauge("total_disk_space", ms::description("Total disk space used"), _stats.total_disk_space_used.on_disk)(cf)(ks),
@@ -3253,6 +3288,10 @@ class compaction_group::compaction_group_view : public compaction::compaction_gr
     int64_t get_sstables_repaired_at() const noexcept override {
         return _cg.get_sstables_repaired_at();
     }
+
+    const utils::estimated_histogram& sstables_per_read_histogram() const noexcept override {
+        return _t.get_stats().estimated_sstable_per_read;
+    }
 };
 
 std::unique_ptr<compaction_group::compaction_group_view> compaction_group::make_compacting_view() {
@@ -4943,6 +4982,171 @@ future<> table::apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_hand
 
 template void table::do_apply(compaction_group& cg, db::rp_handle&&, const frozen_mutation&, const schema_ptr&, const db::large_data_guardrail_base&, db::large_data_cache_tracker*&&, db::large_data_violation_type*&&);
 
+void table::do_apply_batch(compaction_group& cg, std::span<memtable::batch_entry* const> batch, const schema_ptr& m_schema) {
+    utils::latency_counter lc;
+    _stats.writes.set_latency(lc);
+    // A mutation reordered with a truncate fails alone, like in do_apply().
+    std::vector<memtable::batch_entry*> valid;
+    std::vector<db::replay_position> rps;
+    valid.reserve(batch.size());
+    rps.reserve(batch.size());
+    for (auto* e : batch) {
+        db::replay_position rp = e->handle;
+        try {
+            check_valid_rp(rp);
+        } catch (...) {
+            e->error = std::current_exception();
+            continue;
+        }
+        valid.push_back(e);
+        rps.push_back(rp);
+    }
+    // Keep track of the replay positions of the mutations which made it
+    // into the memtable, also when a later one failed.
+    auto update_rps = [&] {
+        for (size_t i = 0; i < valid.size(); ++i) {
+            if (valid[i]->applied) {
+                cg._lowest_rp = std::min(cg._lowest_rp, rps[i]);
+                _highest_rp = std::max(_highest_rp, rps[i]);
+                _stats.writes.mark(lc);
+            }
+        }
+    };
+    try {
+        cg.memtables()->active_memtable().apply(valid, m_schema, *_large_data_guardrail);
+    } catch (...) {
+        update_rps();
+        _failed_counter_applies_to_memtable++;
+        throw;
+    }
+    update_rps();
+}
+
+// Upper bound on the size of the mutations applied to a memtable in one
+// run_when_memory_available() call, so that a batch can't be admitted at
+// once regardless of how much dirty memory it takes.
+static constexpr size_t max_memtable_batch_size = 256 * 1024;
+
+future<> table::apply(std::span<memtable::batch_entry> batch, schema_ptr m_schema, db::timeout_clock::time_point timeout) {
+    auto fail = [] (memtable::batch_entry& e, std::exception_ptr ex) {
+        if (!e.applied && !e.error) {
+            e.error = std::move(ex);
+        }
+    };
+
+    if (_virtual_writer || _logstor) [[unlikely]] {
+        // Neither of them checks guardrails.
+        for (auto& e : batch) {
+            auto f = co_await coroutine::as_future(apply(*e.mut, m_schema, std::move(e.handle), timeout, db::noop_large_data_guardrail::instance()));
+            if (f.failed()) {
+                fail(e, f.get_exception());
+            } else {
+                e.applied = true;
+            }
+        }
+        co_return;
+    }
+
+    struct chunk {
+        compaction_group* cg;
+        named_gate::holder holder;
+        std::vector<memtable::batch_entry*> entries;
+        size_t size = 0;
+    };
+    // Usually all mutations land in the same compaction group. Gates are
+    // held up front so that groups stay alive while we wait for memory.
+    std::vector<chunk> chunks;
+    for (auto& e : batch) {
+        try {
+            auto& cg = compaction_group_for_key(e.mut->key(), m_schema);
+            const auto size = e.mut->representation().size();
+            auto it = std::ranges::find_if(chunks, [&] (const chunk& c) {
+                return c.cg == &cg && c.size + size <= max_memtable_batch_size;
+            });
+            if (it == chunks.end()) {
+                chunks.push_back(chunk{&cg, cg.async_gate().hold()});
+                it = std::prev(chunks.end());
+            }
+            it->entries.push_back(&e);
+            it->size += size;
+        } catch (...) {
+            fail(e, std::current_exception());
+        }
+    }
+
+    for (auto& c : chunks) {
+        auto f = co_await coroutine::as_future(dirty_memory_region_group().run_when_memory_available([this, &c, &m_schema] {
+            do_apply_batch(*c.cg, c.entries, m_schema);
+        }, timeout));
+        if (f.failed()) {
+            auto ex = f.get_exception();
+            for (auto* e : c.entries) {
+                fail(*e, ex);
+            }
+        }
+    }
+}
+
+future<> table::apply_coalesced(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h,
+        db::timeout_clock::time_point timeout, shared_ptr<db::large_data_guardrail_base> guardrails, db::large_data_violation_type* violations_out) {
+    if (_virtual_writer || _logstor) [[unlikely]] {
+        return apply(m, std::move(m_schema), std::move(h), timeout, std::move(guardrails), violations_out);
+    }
+
+  try {
+    const auto size = m.representation().size();
+    // The batch waits for memory with a single deadline, so writes with
+    // different timeouts don't share one. Timeouts are based on the lowres
+    // clock, so writes issued with the same timeout setting in one task
+    // quota usually still do.
+    if (!_open_write_batch || _open_write_batch->schema->version() != m_schema->version()
+            || _open_write_batch->timeout != timeout
+            || _open_write_batch->size + size > max_memtable_batch_size) {
+        auto holder = _async_gate.hold();
+        _open_write_batch = make_lw_shared<write_batch>(m_schema, timeout);
+        // Waited on via the promises of the batch.
+        (void)apply_write_batch(_open_write_batch).finally([holder = std::move(holder)] {});
+    }
+    auto& batch = *_open_write_batch;
+    auto& w = batch.waiters.emplace_back(std::move(guardrails));
+    try {
+        batch.entries.push_back(memtable::batch_entry{&m, std::move(h), w.guardrails.get(), violations_out});
+    } catch (...) {
+        batch.waiters.pop_back();
+        throw;
+    }
+    batch.size += size;
+    return w.done.get_future();
+  } catch (...) {
+    return current_exception_as_future();
+  }
+}
+
+future<> table::apply_write_batch(lw_shared_ptr<write_batch> batch) {
+    co_await seastar::yield();
+    if (_open_write_batch == batch) {
+        _open_write_batch = nullptr;
+    }
+    if (batch->entries.size() == 1) {
+        auto& e = batch->entries.front();
+        auto& w = batch->waiters.front();
+        auto f = co_await coroutine::as_future(apply(*e.mut, batch->schema, std::move(e.handle), batch->timeout,
+                std::move(w.guardrails), e.violations_out));
+        f.forward_to(std::move(w.done));
+        co_return;
+    }
+    _stats.memtable_coalesced_writes += batch->entries.size();
+    co_await apply(batch->entries, batch->schema, batch->timeout);
+    for (size_t i = 0; i < batch->entries.size(); ++i) {
+        auto& e = batch->entries[i];
+        if (e.applied) {
+            batch->waiters[i].done.set_value();
+        } else {
+            batch->waiters[i].done.set_exception(e.error);
+        }
+    }
+}
+
 future<>
 write_memtable_to_sstable(mutation_reader reader,
                           memtable& mt, sstables::shared_sstable sst,
@@ -5024,7 +5228,12 @@ table::query(schema_ptr query_schema,
 
         if (!querier_opt) {
             querier_base::querier_config conf(_config.tombstone_warn_threshold);
-            querier_opt = querier(as_mutation_source(), query_schema, permit, range, qs.cmd.slice, trace_state, get_tombstone_gc_state(), conf);
+            auto slice = qs.cmd.slice;
+            // The data query result only contains the selected columns, so
+            // sstable readers can skip the values of the others, as long as
+            // the read doesn't go through (and populate) the cache.
+            slice.set_allow_column_projection(slice.options.contains<query::partition_slice::option::bypass_cache>());
+            querier_opt = querier(as_mutation_source(), query_schema, permit, range, std::move(slice), trace_state, get_tombstone_gc_state(), conf);
         }
         auto& q = *querier_opt;
 
@@ -5056,6 +5265,46 @@ table::query(schema_ptr query_schema,
     co_return make_lw_shared<query::result>(qs.builder.build(std::move(last_pos)));
 }
 
+future<>
+table::consume_live_rows(schema_ptr query_schema,
+        reader_permit permit,
+        const query::read_command& cmd,
+        const dht::partition_range_vector& partition_ranges,
+        live_row_consumer& consumer,
+        tracing::trace_state_ptr trace_state,
+        db::timeout_clock::time_point timeout) {
+    const auto table_async_gate_holder = _async_gate.hold();
+    utils::latency_counter lc;
+    _stats.reads.set_latency(lc);
+
+    auto finally = defer([&] () noexcept {
+        _stats.reads.mark(lc);
+    });
+
+    for (const auto& range : partition_ranges) {
+        querier_base::querier_config conf(_config.tombstone_warn_threshold);
+        auto slice = cmd.slice;
+        slice.set_allow_column_projection(slice.options.contains<query::partition_slice::option::bypass_cache>());
+        auto q = querier(as_mutation_source(), query_schema, permit, range, std::move(slice), trace_state, get_tombstone_gc_state(), conf);
+
+        std::exception_ptr ex;
+        try {
+            do {
+                if (db::timeout_clock::now() >= timeout) {
+                    throw timed_out_error();
+                }
+                co_await q.consume_page(live_row_consumer_adaptor(consumer), live_rows_page_size, query::max_partitions, cmd.timestamp, trace_state);
+            } while (q.are_limits_reached());
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        co_await q.close();
+        if (ex) {
+            co_return coroutine::exception(std::move(ex));
+        }
+    }
+}
+
 future<reconcilable_result>
 table::mutation_query(schema_ptr query_schema,
         reader_permit permit,
@@ -5121,6 +5370,30 @@ void table::add_coordinator_read_latency(utils::estimated_histogram::duration la
     _stats.estimated_coordinator_read.add(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
 }
 
+void table::add_replica_read_latency(locator::host_id addr, utils::estimated_histogram::duration latency) {
+    auto sample = std::chrono::duration_cast<std::chrono::microseconds>(latency);
+    auto& e = _replica_read_latencies[addr];
+    if (e.mean.count() == 0) {
+        e.mean = sample;
+        e.deviation = sample / 2;
+        return;
+    }
+    e.deviation = (3 * e.deviation + std::chrono::abs(e.mean - sample)) / 4;
+    e.mean = (7 * e.mean + sample) / 8;
+}
+
+std::optional<std::chrono::microseconds> table::predict_replica_read_latency(locator::host_id addr) const {
+    auto it = _replica_read_latencies.find(addr);
+    if (it == _replica_read_latencies.end()) {
+        return std::nullopt;
+    }
+    return it->second.mean + 4 * it->second.deviation;
+}
+
+void table::drop_replica_read_latency(locator::host_id addr) {
+    _replica_read_latencies.erase(addr);
+}
+
 std::chrono::milliseconds table::get_coordinator_read_latency_percentile(double percentile) {
     if (_cached_percentile != percentile || lowres_clock::now() - _percentile_cache_timestamp > 1s) {
         _percentile_cache_timestamp = lowres_clock::now();
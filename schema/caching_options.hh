@@ -25,7 +25,9 @@ class caching_options {
     sstring _key_cache;
     sstring _row_cache;
     bool _enabled = true;
-    caching_options(sstring k, sstring r, bool enabled);
+    // Serve reads of hot partitions from a short-lived cache on the coordinator.
+    bool _coordinator = false;
+    caching_options(sstring k, sstring r, bool enabled, bool coordinator = false);
 
     friend class schema;
     caching_options();
@@ -37,6 +39,10 @@ class caching_options {
         return _enabled;
     }
 
+    bool coordinator_cache_enabled() const {
+        return _coordinator;
+    }
+
     std::map<sstring, sstring> to_map() const;
 
     sstring to_sstring() const;
@@ -36,6 +36,7 @@
 #include "db/tags/utils.hh"
 #include "db/tags/extension.hh"
 #include "index/target_parser.hh"
+#include "index/secondary_index.hh"
 #include "utils/hashing.hh"
 #include "utils/hashers.hh"
 #include "alternator/extract_from_attrs.hh"
@@ -1073,6 +1074,13 @@ managed_string schema::get_create_statement(const schema_describe_helper& helper
             if (is_compact_table()) {
                 os << "COMPACT STORAGE\n    AND ";
             }
+            const auto& indices = helper.base_schema->all_indices();
+            if (auto im = indices.find(secondary_index::index_name_from_table_name(cf_name())); im != indices.end() && !custom_index_class) {
+                const auto& index_options = im->second.options();
+                if (auto it = index_options.find(db::index::secondary_index::included_columns_option_name); it != index_options.end()) {
+                    os << "options = {'" << it->first << "': '" << it->second << "'}\n    AND ";
+                }
+            }
             schema_properties(helper, os);
             os << ";\n";
 
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "service/coordinator_read_cache.hh"
+#include "idl/read_command.dist.hh"
+#include "idl/read_command.dist.impl.hh"
+
+namespace service {
+
+bytes coordinator_read_cache::command_key(const query::read_command& cmd) {
+    const uint64_t row_limit = cmd.get_row_limit();
+    const uint32_t partition_limit = cmd.partition_limit;
+    auto key = ser::serialize_to_buffer<bytes>(cmd.slice, sizeof(row_limit) + sizeof(partition_limit));
+    std::memcpy(key.begin(), &row_limit, sizeof(row_limit));
+    std::memcpy(key.begin() + sizeof(row_limit), &partition_limit, sizeof(partition_limit));
+    return key;
+}
+
+std::optional<coordinator_read_cache::hit> coordinator_read_cache::find(const query::read_command& cmd, const bytes& command_key,
+        const dht::decorated_key& dk, clock_type::duration ttl) {
+    auto it = _partitions.find(partition_id{cmd.cf_id, dk.token()});
+    if (it == _partitions.end()) {
+        return std::nullopt;
+    }
+    const auto now = clock_type::now();
+    auto& entries = it->second;
+    for (auto e = entries.begin(); e != entries.end(); ++e) {
+        if (e->version != cmd.schema_version || e->command != command_key || e->key.representation() != dk.key().representation()) {
+            continue;
+        }
+        if (now - e->created > ttl) {
+            erase(entries, e);
+            if (entries.empty()) {
+                _partitions.erase(it);
+            }
+            return std::nullopt;
+        }
+        return hit{e->result, now - e->created};
+    }
+    return std::nullopt;
+}
+
+void coordinator_read_cache::erase(std::vector<entry>& entries, std::vector<entry>::iterator it) noexcept {
+    _memory -= it->memory;
+    --_size;
+    entries.erase(it);
+}
+
+void coordinator_read_cache::evict_expired(clock_type::duration ttl) noexcept {
+    const auto now = clock_type::now();
+    std::erase_if(_partitions, [&] (auto& p) {
+        _size -= std::erase_if(p.second, [&] (const entry& e) {
+            if (now - e.created > ttl) {
+                _memory -= e.memory;
+                return true;
+            }
+            return false;
+        });
+        return p.second.empty();
+    });
+}
+
+void coordinator_read_cache::insert(const query::read_command& cmd, bytes command_key, const dht::decorated_key& dk,
+        const query::result& result, epoch_type read_epoch, clock_type::duration ttl) noexcept {
+    const auto id = partition_id{cmd.cf_id, dk.token()};
+    if (result.is_short_read() || epoch_of(id) != read_epoch) {
+        return;
+    }
+    const size_t memory = sizeof(entry) + result.buf().size() + command_key.size() + dk.key().representation().size();
+    if (_size >= _max_entries || _memory + memory > _max_memory) {
+        evict_expired(ttl);
+        if (_size >= _max_entries || _memory + memory > _max_memory) {
+            return;
+        }
+    }
+    try {
+        auto cached = make_lw_shared<query::result>(bytes_ostream(result.buf()), result.digest(), result.last_modified(),
+                result.is_short_read(), result.row_count_low_bits(), result.partition_count(), result.row_count_high_bits(),
+                result.last_position());
+        auto& entries = _partitions[id];
+        auto it = std::ranges::find_if(entries, [&] (const entry& e) {
+            return e.version == cmd.schema_version && e.command == command_key && e.key.representation() == dk.key().representation();
+        });
+        if (it != entries.end()) {
+            erase(entries, it);
+        }
+        entries.push_back(entry{
+            .version = cmd.schema_version,
+            .key = dk.key(),
+            .command = std::move(command_key),
+            .result = std::move(cached),
+            .created = clock_type::now(),
+            .memory = memory,
+        });
+        ++_size;
+        _memory += memory;
+    } catch (...) {
+        // Caching is an optimization, the read already succeeded.
+    }
+}
+
+size_t coordinator_read_cache::invalidate(table_id table, dht::token token) noexcept {
+    const auto id = partition_id{table, token};
+    ++epoch_of(id);
+    if (_partitions.empty()) {
+        return 0;
+    }
+    auto it = _partitions.find(id);
+    if (it == _partitions.end()) {
+        return 0;
+    }
+    auto n = it->second.size();
+    for (const auto& e : it->second) {
+        _memory -= e.memory;
+    }
+    _size -= n;
+    _partitions.erase(it);
+    return n;
+}
+
+} // namespace service
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include "bytes.hh"
+#include "dht/decorated_key.hh"
+#include "keys/keys.hh"
+#include "query/query-request.hh"
+#include "query/query-result.hh"
+#include "schema/schema_fwd.hh"
+
+namespace service {
+
+// A small per-shard cache of the results of reads of hot partitions, used by
+// the coordinator for single-partition reads at CL=ONE/LOCAL_ONE of tables
+// with caching = {'coordinator': 'true'}. Serving such reads locally spreads
+// the load of a hot partition over all the coordinator shards of the cluster,
+// instead of having the replica shard owning it serve every one of them.
+//
+// Entries expire after a short TTL, which bounds their staleness, and are
+// dropped when a write to their partition is coordinated on this shard, so a
+// client reads its own writes. Writes coordinated elsewhere are only seen
+// once the entry expires.
+//
+// A read which missed the cache may race with such a write and return the
+// data from before it. To keep it from caching that result, each write
+// bumps the invalidation epoch of its partition when it starts and when it
+// completes, and a result is cached only if the epoch of its partition did
+// not change since the read started. Epochs are kept in a fixed number of
+// buckets, so a write may also prevent caching results of unrelated
+// partitions, but never the other way around.
+class coordinator_read_cache {
+public:
+    using clock_type = seastar::lowres_clock;
+    using epoch_type = uint64_t;
+
+    static constexpr size_t default_max_entries = 1024;
+    static constexpr size_t default_max_memory = 4 * 1024 * 1024;
+
+    struct hit {
+        lw_shared_ptr<query::result> result;
+        clock_type::duration age;
+    };
+
+private:
+    struct partition_id {
+        table_id table;
+        dht::token token;
+
+        bool operator==(const partition_id&) const = default;
+    };
+
+    struct partition_id_hash {
+        size_t operator()(const partition_id& id) const noexcept {
+            return std::hash<table_id>()(id.table) ^ std::hash<dht::token>()(id.token);
+        }
+    };
+
+    struct entry {
+        table_schema_version version;
+        partition_key key;
+        bytes command;
+        lw_shared_ptr<query::result> result;
+        clock_type::time_point created;
+        size_t memory;
+    };
+
+    static constexpr size_t epoch_buckets = 1024;
+
+    const size_t _max_entries;
+    const size_t _max_memory;
+    std::unordered_map<partition_id, std::vector<entry>, partition_id_hash> _partitions;
+    std::array<epoch_type, epoch_buckets> _epochs = {};
+    size_t _size = 0;
+    size_t _memory = 0;
+
+private:
+    void evict_expired(clock_type::duration ttl) noexcept;
+    void erase(std::vector<entry>& entries, std::vector<entry>::iterator it) noexcept;
+    epoch_type& epoch_of(const partition_id& id) noexcept {
+        return _epochs[partition_id_hash()(id) % epoch_buckets];
+    }
+
+public:
+    explicit coordinator_read_cache(size_t max_entries = default_max_entries, size_t max_memory = default_max_memory) noexcept
+        : _max_entries(max_entries)
+        , _max_memory(max_memory)
+    { }
+
+    // Serializes the parts of the command which determine its result.
+    static bytes command_key(const query::read_command& cmd);
+
+    // The invalidation epoch of the partition, to be taken before reading
+    // it from the replicas and passed to insert().
+    epoch_type epoch(table_id table, dht::token token) noexcept {
+        return epoch_of(partition_id{table, token});
+    }
+
+    std::optional<hit> find(const query::read_command& cmd, const bytes& command_key, const dht::decorated_key& dk,
+            clock_type::duration ttl);
+
+    // Caches a copy of the result, detached from the memory accounting of
+    // the replica that produced it. Short reads are not cached, and neither
+    // are results of reads which raced with a write of their partition,
+    // that is when the epoch of the partition is no longer read_epoch.
+    // When the cache is full of entries which did not expire yet, by count
+    // or by memory, nothing is cached.
+    void insert(const query::read_command& cmd, bytes command_key, const dht::decorated_key& dk,
+            const query::result& result, epoch_type read_epoch, clock_type::duration ttl) noexcept;
+
+    // Drops all entries of the given partition and bumps its epoch, returns
+    // the number of dropped entries. Called both when a write of the
+    // partition starts and when it completes.
+    size_t invalidate(table_id table, dht::token token) noexcept;
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    // Memory used by the cached results and their keys.
+    size_t memory() const noexcept {
+        return _memory;
+    }
+};
+
+} // namespace service
@@ -263,6 +263,140 @@ class partition_ranges_owned_by_this_shard {
     }
 };
 
+// Folds the live rows of a local read into the aggregates of a result set
+// builder as they stream out of the replica, like result_set_builder::visitor
+// does with the rows of a query::result.
+class aggregating_row_consumer final : public replica::live_row_consumer {
+    const schema& _schema;
+    const cql3::selection::selection& _selection;
+    const query::partition_slice& _slice;
+    cql3::selection::result_set_builder& _builder;
+    std::optional<partition_key> _key;
+    row _static_cells;
+    bool _static_row_live = false;
+    bool _has_rows = false;
+
+private:
+    void add_cell(const column_definition& def, const row& cells) {
+        const atomic_cell_or_collection* cell = cells.find_cell(def.id);
+        if (!cell) {
+            _builder.add_empty();
+            return;
+        }
+        auto c = cell->as_atomic_cell(def);
+        if (!c.is_live()) {
+            _builder.add_empty();
+            return;
+        }
+        _builder.add(c.value().linearize());
+    }
+
+    void add_row(const row* regular_cells) {
+        const auto& pk = _builder.current_partition_key;
+        const auto& ck = _builder.current_clustering_key;
+        _builder.start_new_row();
+        for (auto&& def : _selection.get_columns()) {
+            switch (def->kind) {
+            case column_kind::partition_key:
+                _builder.add(pk[def->component_index()]);
+                break;
+            case column_kind::clustering_key:
+                if (ck.size() > def->component_index()) {
+                    _builder.add(ck[def->component_index()]);
+                } else {
+                    _builder.add({});
+                }
+                break;
+            case column_kind::regular_column:
+                if (regular_cells) {
+                    add_cell(*def, *regular_cells);
+                } else {
+                    _builder.add_empty();
+                }
+                break;
+            case column_kind::static_column:
+                add_cell(*def, _static_cells);
+                break;
+            default:
+                throwing_assert(0);
+            }
+        }
+        _builder.complete_row();
+    }
+
+public:
+    aggregating_row_consumer(const schema& s, const cql3::selection::selection& selection, const query::partition_slice& slice,
+            cql3::selection::result_set_builder& builder)
+        : _schema(s), _selection(selection), _slice(slice), _builder(builder) { }
+
+    // Whether the rows of a read with the given selection can be folded
+    // without a query::result: only atomic cells, which are returned as they
+    // are stored, and neither their timestamps nor TTLs.
+    static bool supports(const schema& s, const cql3::selection::selection& selection, const query::partition_slice& slice) {
+        return !s.is_counter()
+                && !slice.options.contains<query::partition_slice::option::send_timestamp>()
+                && !slice.options.contains<query::partition_slice::option::send_expiry>()
+                && !slice.options.contains<query::partition_slice::option::send_ttl>()
+                && std::ranges::all_of(selection.get_columns(), [] (const column_definition* def) {
+                    return def->is_primary_key() || def->is_atomic();
+                })
+                // The rows are folded while the reader is consumed, outside of a thread.
+                && std::ranges::none_of(selection.used_functions(), [] (const shared_ptr<cql3::functions::function>& f) {
+                    return f->requires_thread();
+                });
+    }
+
+    virtual void consume_new_partition(const dht::decorated_key& dk) override {
+        _key = dk.key();
+        _builder.current_partition_key = dk.key().explode(_schema);
+        _builder.current_clustering_key.clear();
+        _builder.accept_new_partition(_builder.current_partition_key);
+        _static_cells = row();
+        _static_row_live = false;
+        _has_rows = false;
+    }
+
+    virtual void consume(static_row&& sr) override {
+        _static_cells = std::move(sr.cells());
+        _static_row_live = true;
+    }
+
+    virtual void consume(clustering_row&& cr) override {
+        _builder.current_clustering_key = cr.key().explode(_schema);
+        add_row(&cr.cells());
+        _has_rows = true;
+    }
+
+    virtual void consume_end_of_partition() override {
+        // A partition without live rows is returned for its static row, unless
+        // the read restricts the clustering key, see mutation_querier.
+        if (!_has_rows && _static_row_live && (_slice.options.contains<query::partition_slice::option::always_return_static_content>()
+                || !has_ck_selector(_slice.row_ranges(_schema, *_key)))) {
+            _builder.current_clustering_key.clear();
+            add_row(nullptr);
+        }
+        _builder.accept_partition_end();
+    }
+};
+
+// Whether the range, owned by this shard, can be read from this shard alone
+// at the consistency level of the request. Like when dispatching, the
+// replicas of a range are the ones of its end token, as it doesn't span
+// vnodes or tablets.
+static bool can_read_locally(const schema& s, const locator::effective_replication_map& erm, const query::mapreduce_request& req,
+        const dht::partition_range& range) {
+    if (req.cl != db::consistency_level::ONE && req.cl != db::consistency_level::LOCAL_ONE) {
+        return false;
+    }
+    const auto& token = end_token(range);
+    // Ranges of a shard hint are not intersected with the sharder, and the
+    // tablet may have moved to another shard since the hint was chosen.
+    if (req.shard_id_hint && erm.shard_for_reads(s, token) != this_shard_id()) {
+        return false;
+    }
+    return std::ranges::contains(erm.get_replicas_for_reading(token), erm.get_topology().my_host_id());
+}
+
 // `retrying_dispatcher` is a class that dispatches mapreduce_requests to other
 // nodes. In case of a failure, local retries are available - request being
 // retried is executed on the super-coordinator.
@@ -475,6 +609,11 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
     ranges_owned_by_this_shard.reserve(std::min(max_ranges, req.pr.size()));
     partition_ranges_owned_by_this_shard owned_iter(schema, std::move(req.pr), req.shard_id_hint);
 
+    const bool aggregate_locally = _db.local().get_config().enable_local_aggregation_pushdown()
+            && aggregating_row_consumer::supports(*schema, *selection, req.cmd.slice);
+    auto erm = schema->table().get_effective_replication_map();
+    aggregating_row_consumer local_consumer(*schema, *selection, req.cmd.slice, rs_builder);
+
     std::optional<dht::partition_range> current_range;
     do {
         while ((current_range = owned_iter.next(*schema))) {
@@ -486,6 +625,28 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
         if (ranges_owned_by_this_shard.empty()) {
             break;
         }
+
+        if (aggregate_locally) {
+            // Ranges this node is a replica of are folded into the aggregates
+            // as they are read, without building result pages.
+            auto remote = std::ranges::stable_partition(ranges_owned_by_this_shard, [&] (const dht::partition_range& r) {
+                return can_read_locally(*schema, *erm, req, r);
+            });
+            auto local_ranges = std::ranges::subrange(ranges_owned_by_this_shard.begin(), remote.begin())
+                    | std::views::as_rvalue | std::ranges::to<dht::partition_range_vector>();
+            ranges_owned_by_this_shard.erase(ranges_owned_by_this_shard.begin(), remote.begin());
+            if (!local_ranges.empty()) {
+                if (_shutdown) {
+                    throw std::runtime_error("mapreduce_service is shutting down");
+                }
+                tracing::trace(tr_state, "Aggregating {} ranges from the local replica", local_ranges.size());
+                co_await _db.local().consume_live_rows(schema, req.cmd, local_ranges, local_consumer, tr_state, timeout);
+                _stats.ranges_aggregated_locally += local_ranges.size();
+            }
+            if (ranges_owned_by_this_shard.empty()) {
+                continue;
+            }
+        }
         flogger.trace("Forwarding to {} ranges owned by this shard", ranges_owned_by_this_shard.size());
 
         auto pager = service::pager::query_pagers::pager(
@@ -825,6 +986,8 @@ void mapreduce_service::register_metrics() {
              sm::description("how many mapreduce requests were dispatched to local shards"), {}),
         sm::make_total_operations("requests_executed", _stats.requests_executed,
              sm::description("how many mapreduce requests were executed"), {}),
+        sm::make_total_operations("ranges_aggregated_locally", _stats.ranges_aggregated_locally,
+             sm::description("how many partition ranges of mapreduce requests were aggregated as they were read from the local replica, without building query results"), {}),
     });
 }
 
@@ -146,11 +146,15 @@ class mapreduce_service : public seastar::peering_sharded_service<mapreduce_serv
     sharded<replica::database>& _db;
     abort_source _abort_outgoing_tasks;
 
+public:
     struct stats {
         uint64_t requests_dispatched_to_other_nodes = 0;
         uint64_t requests_dispatched_to_own_shards = 0;
         uint64_t requests_executed = 0;
-    } _stats;
+        uint64_t ranges_aggregated_locally = 0;
+    };
+private:
+    stats _stats;
     seastar::metrics::metric_groups _metrics;
 
     optimized_optional<abort_source::subscription> _early_abort_subscription;
@@ -177,6 +181,10 @@ class mapreduce_service : public seastar::peering_sharded_service<mapreduce_serv
     // subrequests across a cluster.
     future<query::mapreduce_result> dispatch(query::mapreduce_request req, tracing::trace_state_ptr tr_state);
 
+    const stats& get_stats() const noexcept {
+        return _stats;
+    }
+
 private:
     future<> dispatch_range_and_reduce(const locator::effective_replication_map_ptr& erm, retrying_dispatcher& dispatcher, query::mapreduce_request const& req, query::mapreduce_request&& req_with_modified_pr, locator::host_id addr, query::mapreduce_result& result_, tracing::trace_state_ptr tr_state);
     future<> dispatch_to_vnodes(schema_ptr schema, replica::column_family& cf, query::mapreduce_request& req, query::mapreduce_result& result, tracing::trace_state_ptr tr_state);
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <algorithm>
+
+namespace service {
+
+// Limits the speculative read retries sent by adaptive speculative retry to
+// a ratio of the reads, so that an overloaded cluster, where every replica
+// is slower than predicted, is not loaded further with retries.
+//
+// Each read deposits the ratio of a retry, and each retry consumes a whole
+// one. Up to max_retries retries can be saved up for a burst.
+class speculative_retry_budget {
+    double _retries = 0;
+public:
+    static constexpr double max_retries = 10;
+
+    void deposit(double ratio) noexcept {
+        _retries = std::min(_retries + ratio, max_retries);
+    }
+
+    // Returns whether a retry may be sent. A retry replacing a replica which
+    // disconnected is always sent, and doesn't use up the budget.
+    bool consume(bool replica_disconnected = false) noexcept {
+        if (replica_disconnected) {
+            return true;
+        }
+        if (_retries < 1) {
+            return false;
+        }
+        _retries -= 1;
+        return true;
+    }
+
+    double available() const noexcept {
+        return _retries;
+    }
+};
+
+} // namespace service
@@ -13,6 +13,7 @@
 #include <ranges>
 
 #include <fmt/ranges.h>
+#include <seastar/core/reactor.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/later.hh>
@@ -66,6 +67,7 @@
 #include "service/paxos/prepare_summary.hh"
 #include "service/migration_manager.hh"
 #include "service/client_state.hh"
+#include "service/coordinator_read_cache.hh"
 #include "service/paxos/proposal.hh"
 #include "db/large_data_handler.hh"
 #include "service/topology_mutation.hh"
@@ -767,7 +769,7 @@ class storage_proxy::remote {
             rpc::optional<uint8_t> large_data_violations_opt) {
         auto& from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
         auto violations = static_cast<db::large_data_violation_type>(large_data_violations_opt.value_or(0));
-        _sp.get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        _sp.account_cross_shard_op(shard);
         return _sp.container().invoke_on(shard, _sp._write_ack_smp_service_group,
                 [from, response_id, backlog = std::move(backlog), violations] (storage_proxy& sp) mutable {
             sp.got_response(response_id, from, std::move(backlog), violations);
@@ -780,7 +782,7 @@ class storage_proxy::remote {
             unsigned shard, storage_proxy::response_id_type response_id, size_t num_failed,
             rpc::optional<db::view::update_backlog> backlog, rpc::optional<replica::exception_variant> exception) {
         auto& from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
-        _sp.get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        _sp.account_cross_shard_op(shard);
         return _sp.container().invoke_on(shard, _sp._write_ack_smp_service_group,
                 [from, response_id, num_failed, backlog = std::move(backlog), exception = std::move(exception)] (storage_proxy& sp) mutable {
             error err = error::FAILURE;
@@ -1041,8 +1043,7 @@ class storage_proxy::remote {
         co_await _sp.apply_fence(fence_opt, src_addr);
 
         unsigned shard = schema->table().shard_for_reads(token);
-        bool local = shard == this_shard_id();
-        _sp.get_stats().replica_cross_shard_ops += !local;
+        _sp.account_cross_shard_op(shard);
         auto result = co_await _sp.container().invoke_on(shard, _sp._write_smp_service_group, [gs = global_schema_ptr(schema), gt = tracing::global_trace_state_ptr(std::move(tr_state)),
                                     cmd = make_lw_shared<query::read_command>(std::move(cmd)), key = std::move(key),
                                     ballot, only_digest, da, timeout, src_addr, &paxos_store = _paxos_store] (storage_proxy& sp) -> future<foreign_ptr<std::unique_ptr<service::paxos::prepare_response>>> {
@@ -1087,8 +1088,7 @@ class storage_proxy::remote {
         co_await _sp.apply_fence(fence_opt, src_addr);
 
         unsigned shard = schema->table().shard_for_reads(token);
-        bool local = shard == this_shard_id();
-        _sp.get_stats().replica_cross_shard_ops += !local;
+        _sp.account_cross_shard_op(shard);
         auto result = co_await _sp.container().invoke_on(shard, _sp._write_smp_service_group, coroutine::lambda([gs = global_schema_ptr(schema), gt = tracing::global_trace_state_ptr(tr_state),
                                    proposal = std::move(proposal), timeout, token, this] (storage_proxy& sp) {
             return paxos::paxos_state::accept(sp, paxos_store(), gt, gs, token, proposal, *timeout);
@@ -1134,8 +1134,7 @@ class storage_proxy::remote {
         co_await _sp.apply_fence(fence_opt, src_addr);
 
         unsigned shard = schema->table().shard_for_reads(token);
-        bool local = shard == this_shard_id();
-        _sp.get_stats().replica_cross_shard_ops += !local;
+        _sp.account_cross_shard_op(shard);
         co_await smp::submit_to(shard, _sp._write_smp_service_group, [gs = global_schema_ptr(schema), gt = tracing::global_trace_state_ptr(std::move(tr_state)),
                                     key = std::move(key), ballot, timeout, src_addr, &paxos_store = _paxos_store] () -> future<> {
                 tracing::trace_state_ptr tr_state = gt;
@@ -1149,6 +1148,7 @@ class storage_proxy::remote {
         slogger.debug("Drop hit rate info for {} because of disconnect", id);
         for (auto&& cf : _sp._db.local().get_non_system_column_families()) {
             cf->drop_hit_rate(id);
+            cf->drop_replica_read_latency(id);
         }
     }
 
@@ -1750,6 +1750,9 @@ class abstract_write_response_handler : public seastar::enable_shared_from_this<
     db::large_data_violation_type* violations_out = nullptr;
     db::view::update_backlog _view_backlog; // max view update backlog of all participating targets
     utils::small_vector<gate::holder, 2> _holders;
+    // The partition whose coordinator read cache entries are dropped again
+    // once the write completes.
+    std::optional<dht::token> _read_cache_token;
 
 protected:
     virtual bool waited_for(locator::host_id from) = 0;
@@ -1839,6 +1842,10 @@ class abstract_write_response_handler : public seastar::enable_shared_from_this<
         violations_out = p;
     }
 
+    void set_read_cache_token(dht::token token) {
+        _read_cache_token = token;
+    }
+
     // While delayed, a request is not throttled.
     void unthrottle() {
         _stats.background_writes++;
@@ -1944,6 +1951,9 @@ class abstract_write_response_handler : public seastar::enable_shared_from_this<
         if (_targets.size() == 0) {
             _mutation_holder->release_mutation();
         }
+        if (_read_cache_token) {
+            _proxy->invalidate_coordinator_read_cache(get_schema()->id(), *_read_cache_token);
+        }
     }
     void timeout_cb() {
         if (_cl_achieved || _cl == db::consistency_level::ANY) {
@@ -2845,6 +2855,12 @@ void storage_proxy::remove_response_handler(storage_proxy::response_id_type id)
     remove_response_handler_entry(std::move(entry));
 }
 
+void storage_proxy::invalidate_coordinator_read_cache(table_id table, dht::token token) noexcept {
+    if (auto n = _read_cache->invalidate(table, token)) {
+        get_stats().coordinator_read_cache_invalidations += n;
+    }
+}
+
 void storage_proxy::remove_response_handler_entry(response_handlers_map::iterator entry) {
     entry->second->on_released();
     _response_handlers.erase(std::move(entry));
@@ -3034,6 +3050,11 @@ void storage_proxy_stats::write_stats::register_stats() {
                     sm::description("number of CQL read requests which arrived to a non-replica and had to be forwarded to a replica"),
                     {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
+            sm::make_total_operations("reads_off_last_replicas", reads_off_last_replicas,
+                    sm::description("number of pages of paged reads which could not be sent to any of the replicas that served the previous page, "
+                    "so the readers saved for the query had to be recreated"),
+                    {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
             sm::make_total_operations("writes_failed_due_to_too_many_in_flight_hints", writes_failed_due_to_too_many_in_flight_hints,
                     sm::description("number of CQL write requests which failed because the hinted handoff mechanism is overloaded "
                     "and cannot store any more in-flight hints"),
@@ -3089,6 +3110,23 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of read retry attempts"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
+        sm::make_total_operations("read_cache_hits", coordinator_read_cache_hits,
+                       sm::description("number of reads of hot partitions served from the coordinator read cache"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("read_cache_misses", coordinator_read_cache_misses,
+                       sm::description("number of reads of hot partitions which missed the coordinator read cache"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_counter("read_cache_hit_age", coordinator_read_cache_hit_age_ms,
+                       sm::description("total age, in milliseconds, of the results served from the coordinator read cache; "
+                                       "divided by read_cache_hits it gives the average staleness"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("read_cache_invalidations", coordinator_read_cache_invalidations,
+                       sm::description("number of coordinator read cache entries dropped because of a write coordinated by this shard"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_total_operations("canceled_read_repairs", global_read_repairs_canceled_due_to_concurrent_write,
                        sm::description("number of global read repairs canceled due to a concurrent write"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -3133,6 +3171,10 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of speculative data read requests that were sent"),
                        {storage_proxy_stats::current_scheduling_group_label(), basic_level}).set_skip_when_empty(),
 
+        sm::make_total_operations("speculative_reads_throttled", speculative_reads_throttled,
+                       sm::description("number of speculative read requests that were not sent because they would exceed the adaptive speculative retry budget"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_summary("cas_read_latency_summary", sm::description("CAS read latency summary"), [this] {return to_metrics_summary(cas_read.summary());})(storage_proxy_stats::current_scheduling_group_label())(basic_level)(cas_label).set_skip_when_empty(),
         sm::make_summary("cas_write_latency_summary", sm::description("CAS write latency summary"), [this] {return to_metrics_summary(cas_write.summary());})(storage_proxy_stats::current_scheduling_group_label())(basic_level)(cas_label).set_skip_when_empty(),
 
@@ -3243,6 +3285,14 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of operations that crossed a shard boundary"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
+        sm::make_total_operations("cross_numa_ops", replica_cross_numa_ops,
+                       sm::description("number of operations that crossed a shard boundary into another NUMA node"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_counter("cross_numa_bytes", replica_cross_numa_bytes,
+                       sm::description("number of mutation and query result bytes moved between shards on different NUMA nodes"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_total_operations("fenced_out_requests", replica_fenced_out_requests,
                        sm::description("number of requests that resulted in a stale_topology_exception"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -3389,8 +3439,11 @@ storage_proxy::storage_proxy(sharded<replica::database>& db, storage_proxy::conf
     , _mutate_stage{"storage_proxy_mutate", &storage_proxy::do_mutate}
     , _max_view_update_backlog(max_view_update_backlog)
     , _timeout_config(timeout_config)
+    , _read_cache(std::make_unique<coordinator_read_cache>())
     , _cancellable_write_handlers_list(std::make_unique<cancellable_write_handlers_list>())
 {
+    auto numa_nodes = local_engine->smp().shard_to_numa_node_mapping();
+    _shard_numa_nodes.assign(numa_nodes.begin(), numa_nodes.end());
     namespace sm = seastar::metrics;
     _metrics.add_group(storage_proxy_stats::COORDINATOR_STATS_CATEGORY, {
         sm::make_queue_length("current_throttled_writes", [this] { return _throttled_writes.size(); },
@@ -3496,18 +3549,37 @@ future<db::large_data_violation_type> apply_on_shards_with_violations(const loca
         [] (db::large_data_violation_type a, db::large_data_violation_type b) { return a | b; });
 }
 
+void storage_proxy::account_cross_shard_op(shard_id shard, size_t bytes) noexcept {
+    if (shard == this_shard_id()) {
+        return;
+    }
+    auto& stats = get_stats();
+    ++stats.replica_cross_shard_ops;
+    if (shard < _shard_numa_nodes.size() && _shard_numa_nodes[shard] != _shard_numa_nodes[this_shard_id()]) {
+        ++stats.replica_cross_numa_ops;
+        stats.replica_cross_numa_bytes += bytes;
+    }
+}
+
+void storage_proxy::account_cross_shard_bytes(shard_id shard, size_t bytes) noexcept {
+    if (shard != this_shard_id() && shard < _shard_numa_nodes.size() && _shard_numa_nodes[shard] != _shard_numa_nodes[this_shard_id()]) {
+        get_stats().replica_cross_numa_bytes += bytes;
+    }
+}
+
 future<>
 storage_proxy::mutate_locally(const mutation& m, tracing::trace_state_ptr tr_state, db::commitlog::force_sync sync, clock_type::time_point timeout, smp_service_group smp_grp, db::per_partition_rate_limit::info rate_limit_info) {
     auto erm = _db.local().find_column_family(m.schema()).get_effective_replication_map();
     auto apply = [this, erm, &m, tr_state, sync, timeout, smp_grp, rate_limit_info] (shard_id shard) {
-        get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        auto fm = freeze(m);
+        account_cross_shard_op(shard, fm.representation().size());
         auto shard_rate_limit = rate_limit_info;
         if (shard == this_shard_id()) {
             shard_rate_limit = adjust_rate_limit_for_local_operation(shard_rate_limit);
         }
         return _db.invoke_on(shard, {smp_grp, timeout},
                 [s = global_schema_ptr(m.schema()),
-                 m = freeze(m),
+                 m = std::move(fm),
                  gtr = tracing::global_trace_state_ptr(std::move(tr_state)),
                  erm,
                  timeout,
@@ -3524,7 +3596,7 @@ storage_proxy::mutate_locally(const schema_ptr& s, const frozen_mutation& m, tra
         smp_service_group smp_grp, db::per_partition_rate_limit::info rate_limit_info, bool skip_large_data_guardrails) {
     auto erm = _db.local().find_column_family(s).get_effective_replication_map();
     auto apply = [this, erm, s, &m, tr_state, sync, timeout, smp_grp, rate_limit_info, skip_large_data_guardrails] (shard_id shard) {
-        get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        account_cross_shard_op(shard, m.representation().size());
         auto shard_rate_limit = rate_limit_info;
         if (shard == this_shard_id()) {
             shard_rate_limit = adjust_rate_limit_for_local_operation(shard_rate_limit);
@@ -3560,7 +3632,7 @@ future<>
 storage_proxy::mutate_hint(const schema_ptr& s, const frozen_mutation& m, tracing::trace_state_ptr tr_state, clock_type::time_point timeout) {
     auto erm = _db.local().find_column_family(s).get_effective_replication_map();
     auto apply = [&, erm] (unsigned shard) {
-        get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        account_cross_shard_op(shard, m.representation().size());
         return _db.invoke_on(shard, {_hints_write_smp_service_group, timeout}, [&m, gs = global_schema_ptr(s), tr_state, timeout, erm] (replica::database& db) mutable -> future<> {
             return db.apply_hint(gs, m, tr_state, timeout);
         });
@@ -3729,7 +3801,7 @@ storage_proxy::mutate_counters_on_leader(utils::chunked_vector<frozen_mutation_a
             auto erm = _db.local().find_column_family(fm_a_s.s).get_effective_replication_map();
             auto shard = erm->get_sharder(*fm_a_s.s).shard_for_reads(fm_a_s.fm.token(*fm_a_s.s));
             bool local = shard == this_shard_id();
-            get_stats().replica_cross_shard_ops += !local;
+            account_cross_shard_op(shard, fm_a_s.fm.representation().size());
 
             return container().invoke_on(shard, {_write_smp_service_group, timeout}, [gs = global_schema_ptr(fm_a_s.s), &fm = fm_a_s.fm, cl, timeout, gt = tracing::global_trace_state_ptr(trace_state), permit, local, fence, caller] (storage_proxy& sp) mutable -> future<> {
                 auto p = local ? std::move(permit) : empty_service_permit(); // FIXME: either obtain a real permit on this shard or hold original one across shard
@@ -3789,6 +3861,8 @@ storage_proxy::create_write_response_handler_helper(schema_ptr s, const dht::tok
     replica::table& table = _db.local().find_column_family(s->id());
     auto erm = table.get_effective_replication_map();
 
+    invalidate_coordinator_read_cache(s->id(), token);
+
     host_id_vector_replica_set natural_endpoints;
     host_id_vector_topology_change pending_endpoints;
     if (options.node_local_only) [[unlikely]] {
@@ -3867,8 +3941,14 @@ storage_proxy::create_write_response_handler_helper(schema_ptr s, const dht::tok
 
     db::assure_sufficient_live_nodes(cl, *erm, live_endpoints, pending_endpoints);
 
-    return make_write_response_handler(std::move(erm), cl, type, std::move(mh), std::move(live_endpoints), pending_endpoints,
+    auto id = make_write_response_handler(std::move(erm), cl, type, std::move(mh), std::move(live_endpoints), pending_endpoints,
             std::move(dead_endpoints), std::move(tr_state), get_stats(), std::move(permit), rate_limit_info, cancellable, options.bypass_large_data_guardrails, std::move(options.violations_out));
+    if (id && s->caching_options().coordinator_cache_enabled()) {
+        // A read which started while the write was in flight may have
+        // missed it, keep its result out of the cache.
+        get_write_response_handler(id.value())->set_read_cache_token(token);
+    }
+    return id;
 }
 
 /**
@@ -4135,6 +4215,11 @@ future<> storage_proxy::mutate_counters(Range&& mutations, db::consistency_level
     // so we need a container for them. std::set<> will result in the fewest allocations if there is just one.
     std::set<locator::effective_replication_map_ptr> erms;
 
+    // Counter updates are applied by their leaders, which may be other
+    // shards or nodes, so the coordinator read cache entries of the updated
+    // partitions are dropped here, both before and after the update.
+    utils::small_vector<std::pair<table_id, dht::token>, 1> read_cache_partitions;
+
     const auto fence = fencing_token{_shared_token_metadata.get()->get_version()};
     for (auto& m : mutations) {
         auto& table = _db.local().find_column_family(m.schema()->id());
@@ -4142,8 +4227,17 @@ future<> storage_proxy::mutate_counters(Range&& mutations, db::consistency_level
         erms.insert(erm);
         auto leader = find_leader_for_counter_update(m, *erm, cl);
         leaders[leader].emplace_back(frozen_mutation_and_schema { freeze(m), m.schema() });
+        if (m.schema()->caching_options().coordinator_cache_enabled()) {
+            read_cache_partitions.emplace_back(m.schema()->id(), m.token());
+        }
+        invalidate_coordinator_read_cache(m.schema()->id(), m.token());
         // FIXME: check if CL can be reached
     }
+    auto invalidate_read_cache = defer([this, &read_cache_partitions] () noexcept {
+        for (const auto& [table, token] : read_cache_partitions) {
+            invalidate_coordinator_read_cache(table, token);
+        }
+    });
 
     // Forward mutations to the leaders chosen for them
     auto my_address = my_host_id(**erms.begin());
@@ -5777,7 +5871,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     resolver->add_data(ep, std::get<0>(std::move(v)));
                     ++_proxy->get_stats().data_read_completed.get_ep_stat(get_topology(), ep);
                     _used_targets.push_back(ep);
-                    register_request_latency(latency_clock::now() - start);
+                    register_request_latency(ep, latency_clock::now() - start);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -5805,7 +5899,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     resolver->add_digest(ep, std::get<0>(v), std::get<1>(v), std::get<3>(std::move(v)));
                     ++_proxy->get_stats().digest_read_completed.get_ep_stat(get_topology(), ep);
                     _used_targets.push_back(ep);
-                    register_request_latency(latency_clock::now() - start);
+                    register_request_latency(ep, latency_clock::now() - start);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -5844,6 +5938,9 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
         if (_proxy->features().empty_replica_mutation_pages) {
             cmd->slice.options.set<query::partition_slice::option::allow_mutation_read_page_without_live_row>();
         }
+        // The reconciled mutations are also used to repair replicas, so
+        // they have to contain the rejected rows too.
+        cmd->slice.set_clustering_filter({});
 
         // Waited on indirectly.
         make_mutation_data_requests(cmd, data_resolver, _targets.begin(), _targets.end(), timeout);
@@ -6079,6 +6176,13 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
     void register_request_latency(latency_clock::duration d) {
         _max_request_latency = std::max(_max_request_latency, d);
     }
+    // Also feeds the replica's latency to adaptive speculative retry.
+    void register_request_latency(locator::host_id ep, latency_clock::duration d) {
+        register_request_latency(d);
+        if (_proxy->local_db().get_config().adaptive_speculative_retry()) {
+            _cf->add_replica_read_latency(ep, d);
+        }
+    }
 
     static constexpr latency_clock::duration NO_LATENCY{-1};
     latency_clock::duration _max_request_latency{NO_LATENCY};
@@ -6123,6 +6227,8 @@ class always_speculating_read_executor : public abstract_read_executor {
 // this executor sends request to an additional replica after some time below timeout
 class speculating_read_executor : public abstract_read_executor {
     timer<storage_proxy::clock_type> _speculate_timer;
+    // Retries after a replica disconnected are not subject to the adaptive speculative retry budget.
+    bool _disconnected = false;
 public:
     using abstract_read_executor::abstract_read_executor;
     virtual void make_requests(digest_resolver_ptr resolver, storage_proxy::clock_type::time_point timeout) override {
@@ -6132,8 +6238,16 @@ class speculating_read_executor : public abstract_read_executor {
                                               ", required at least 2 replicas",
                                               _targets.size()));
         }
-        _speculate_timer.set_callback([this, resolver, timeout] {
+        auto& sr = _schema->speculative_retry();
+        const bool adaptive = sr.get_type() == speculative_retry::type::PERCENTILE
+                && _proxy->local_db().get_config().adaptive_speculative_retry();
+        _speculate_timer.set_callback([this, resolver, timeout, adaptive] {
             if (!resolver->is_completed()) { // at the time the callback runs request may be completed already
+                if (adaptive && !_proxy->_speculative_retry_budget.consume(_disconnected)) {
+                    _proxy->get_stats().speculative_reads_throttled++;
+                    tracing::trace(_trace_state, "Not launching speculative retry, speculative retry budget exhausted");
+                    return;
+                }
                 resolver->add_wait_targets(1); // we send one more request so wait for it too
                 // FIXME: consider disabling for CL=*ONE
                 auto send_request = [&] (bool has_data) {
@@ -6150,13 +6264,32 @@ class speculating_read_executor : public abstract_read_executor {
                 send_request(resolver->has_data());
             }
         });
-        auto& sr = _schema->speculative_retry();
-        auto t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
-            std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->_timeout_config.read_timeout_in_ms()/2)) :
+        const auto max_delay = std::chrono::milliseconds(_proxy->_timeout_config.read_timeout_in_ms()/2);
+        std::chrono::microseconds t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
+            std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), max_delay) :
             std::chrono::milliseconds(unsigned(sr.get_value()));
+        if (adaptive) {
+            _proxy->_speculative_retry_budget.deposit(_proxy->local_db().get_config().adaptive_speculative_retry_budget());
+            // The read completes when the slowest of the replicas it was sent to responds,
+            // the extra replica is the last one.
+            std::optional<std::chrono::microseconds> predicted;
+            for (const auto& ep : std::ranges::subrange(_targets.begin(), _targets.end() - 1)) {
+                auto p = _cf->predict_replica_read_latency(ep);
+                if (!p) {
+                    predicted = std::nullopt;
+                    break;
+                }
+                predicted = std::max(predicted.value_or(std::chrono::microseconds::zero()), *p);
+            }
+            if (predicted) {
+                t = std::min<std::chrono::microseconds>(*predicted, max_delay);
+                tracing::trace(_trace_state, "Speculative retry after predicted replica latency of {}us", t.count());
+            }
+        }
         _speculate_timer.arm(t);
         resolver->set_on_disconnect([this] {
             if (_speculate_timer.cancel()) {
+                _disconnected = true;
                 _speculate_timer.arm(clock_type::now());
             }
         });
@@ -6196,6 +6329,7 @@ result<::shared_ptr<abstract_read_executor>> storage_proxy::get_read_executor(lw
         tracing::trace_state_ptr trace_state,
         const host_id_vector_replica_set& preferred_endpoints,
         bool& is_read_non_local,
+        bool& is_read_off_last_replicas,
         service_permit permit,
         node_local_only node_local_only) {
     const dht::token& token = partition_range.start()->value().token();
@@ -6214,6 +6348,11 @@ result<::shared_ptr<abstract_read_executor>> storage_proxy::get_read_executor(lw
             retry_type == speculative_retry::type::NONE ? nullptr : &extra_replica,
             _db.local().get_config().cache_hit_rate_read_balancing() ? &*cf : nullptr);
 
+    if (!preferred_endpoints.empty() && intersection(target_replicas, preferred_endpoints).empty()) {
+        tracing::trace(trace_state, "None of the replicas which served the previous page ({}) are available for reading token {}", preferred_endpoints, token);
+        is_read_off_last_replicas = true;
+    }
+
     slogger.trace("creating read executor for token {} with all: {} targets: {} rp decision: {}", token, all_replicas, target_replicas, repair_decision);
     tracing::trace(trace_state, "Creating read executor for token {} with all: {} targets: {} repair decision: {}", token, all_replicas, target_replicas, repair_decision);
 
@@ -6297,8 +6436,8 @@ storage_proxy::query_result_local(locator::effective_replication_map_ptr erm, sc
     cmd->slice.options.set_if<query::partition_slice::option::with_digest>(opts.request != query::result_request::only_result);
     if (auto shard_opt = dht::is_single_shard(erm->get_sharder(*query_schema), *query_schema, pr)) {
         auto shard = *shard_opt;
-        get_stats().replica_cross_shard_ops += shard != this_shard_id();
-        return _db.invoke_on(shard, _read_smp_service_group, [gs = global_schema_ptr(query_schema), prv = dht::partition_range_vector({pr}) /* FIXME: pr is copied */, cmd, opts, timeout, gt = tracing::global_trace_state_ptr(std::move(trace_state)), rate_limit_info] (replica::database& db) mutable {
+        account_cross_shard_op(shard);
+        auto f = _db.invoke_on(shard, _read_smp_service_group, [gs = global_schema_ptr(query_schema), prv = dht::partition_range_vector({pr}) /* FIXME: pr is copied */, cmd, opts, timeout, gt = tracing::global_trace_state_ptr(std::move(trace_state)), rate_limit_info] (replica::database& db) mutable {
             auto trace_state = gt.get();
             tracing::trace(trace_state, "Start querying singular range {}", prv.front());
             return db.query(gs, *cmd, opts, prv, trace_state, timeout, rate_limit_info).then([trace_state](std::tuple<lw_shared_ptr<query::result>, cache_temperature>&& f_ht) {
@@ -6307,6 +6446,13 @@ storage_proxy::query_result_local(locator::effective_replication_map_ptr erm, sc
                 return make_ready_future<rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>>(rpc::tuple(make_foreign(std::move(f)), ht));
             });
         });
+        if (shard == this_shard_id()) {
+            return f;
+        }
+        return f.then([this, shard] (rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>&& r) {
+            account_cross_shard_bytes(shard, std::get<0>(r)->buf().size());
+            return std::move(r);
+        });
     } else {
         // FIXME: adjust query_*_on_all_shards() to accept an smp_service_group and propagate it there
         tracing::trace(trace_state, "Start querying token range {}", pr);
@@ -6365,9 +6511,34 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
     db::read_repair_decision repair_decision = query_options.read_repair_decision
         ? *query_options.read_repair_decision : db::read_repair_decision::NONE;
 
-    // Update reads_coordinator_outside_replica_set once per request,
-    // not once per partition.
+    // Reads of hot partitions at CL=ONE/LOCAL_ONE of tables which opted in
+    // may be served from the coordinator read cache.
+    std::optional<std::pair<dht::decorated_key, bytes>> read_cache_key;
+    coordinator_read_cache::epoch_type read_cache_epoch = 0;
+    const auto read_cache_ttl = std::chrono::milliseconds(_db.local().get_config().coordinator_read_cache_ttl_in_ms());
+    if (read_cache_ttl.count() && schema->caching_options().coordinator_cache_enabled()
+            && (cl == db::consistency_level::ONE || cl == db::consistency_level::LOCAL_ONE)
+            && partition_ranges.size() == 1 && partition_ranges.front().is_singular()
+            && partition_ranges.front().start()->value().has_key()) {
+        const auto& pos = partition_ranges.front().start()->value();
+        if (_db.local().account_coordinator_read(table, pos.token()) >= _db.local().get_config().coordinator_read_cache_hot_threshold()) {
+            read_cache_key.emplace(pos.as_decorated_key(), coordinator_read_cache::command_key(*cmd));
+            if (auto hit = _read_cache->find(*cmd, read_cache_key->second, read_cache_key->first, read_cache_ttl)) {
+                auto& stats = get_stats();
+                ++stats.coordinator_read_cache_hits;
+                stats.coordinator_read_cache_hit_age_ms += std::chrono::duration_cast<std::chrono::milliseconds>(hit->age).count();
+                tracing::trace(query_options.trace_state, "Served from the coordinator read cache");
+                co_return coordinator_query_result(make_foreign(std::move(hit->result)), {}, repair_decision);
+            }
+            ++get_stats().coordinator_read_cache_misses;
+            read_cache_epoch = _read_cache->epoch(schema->id(), pos.token());
+        }
+    }
+
+    // Update reads_coordinator_outside_replica_set and reads_off_last_replicas
+    // once per request, not once per partition.
     bool is_read_non_local = false;
+    bool is_read_off_last_replicas = false;
 
     for (auto&& pr: partition_ranges) {
         if (!pr.is_singular()) {
@@ -6380,7 +6551,7 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
             ? host_id_vector_replica_set{} : (it->second | std::ranges::to<host_id_vector_replica_set>());
 
         auto r_read_executor = get_read_executor(cmd, erm, schema, std::move(pr), cl, repair_decision,
-                                                 query_options.trace_state, replicas, is_read_non_local,
+                                                 query_options.trace_state, replicas, is_read_non_local, is_read_off_last_replicas,
                                                  query_options.permit,
                                                  query_options.node_local_only);
         if (!r_read_executor) {
@@ -6392,6 +6563,9 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
     if (is_read_non_local) {
         get_stats().reads_coordinator_outside_replica_set++;
     }
+    if (is_read_off_last_replicas) {
+        ++get_stats().reads_off_last_replicas;
+    }
 
     replicas_per_token_range used_replicas;
 
@@ -6447,6 +6621,10 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
         co_return std::move(result).as_failure();
     }
 
+    if (read_cache_key) {
+        _read_cache->insert(*cmd, std::move(read_cache_key->second), read_cache_key->first, *result.value(), read_cache_epoch, read_cache_ttl);
+    }
+
     co_return coordinator_query_result(std::move(result).value(), std::move(used_replicas), repair_decision);
 }
 
@@ -6504,6 +6682,8 @@ storage_proxy::query_partition_key_range_concurrent(storage_proxy::clock_type::t
         return it == preferred_replicas.end() ? host_id_vector_replica_set{} : (it->second | std::ranges::to<host_id_vector_replica_set>());
     };
     const auto to_token_range = [] (const dht::partition_range& r) { return r.transform(std::mem_fn(&dht::ring_position::token)); };
+    // reads_off_last_replicas counts pages, not the ranges of a page.
+    bool is_read_off_last_replicas = false;
 
     for (;;) {
         std::vector<::shared_ptr<abstract_read_executor>> exec;
@@ -6525,6 +6705,10 @@ storage_proxy::query_partition_key_range_concurrent(storage_proxy::clock_type::t
             host_id_vector_replica_set live_endpoints = get_endpoints_for_reading(*schema, *erm, end_token(range), node_local_only);
             host_id_vector_replica_set merged_preferred_replicas = preferred_replicas_for_range(*i);
             host_id_vector_replica_set filtered_endpoints = filter_replicas_for_read(cl, *erm, live_endpoints, merged_preferred_replicas, pcf);
+            if (!merged_preferred_replicas.empty() && intersection(filtered_endpoints, merged_preferred_replicas).empty()
+                    && !std::exchange(is_read_off_last_replicas, true)) {
+                ++get_stats().reads_off_last_replicas;
+            }
             std::vector<dht::token_range> merged_ranges{to_token_range(range)};
             ++i;
 
@@ -7337,13 +7521,20 @@ storage_proxy::query_mutations_locally(schema_ptr query_schema, lw_shared_ptr<qu
     auto erm = table.get_effective_replication_map();
     if (auto shard_opt = dht::is_single_shard(erm->get_sharder(*query_schema), *query_schema, pr)) {
         auto shard = *shard_opt;
-        get_stats().replica_cross_shard_ops += shard != this_shard_id();
-        return _db.invoke_on(shard, _read_smp_service_group, [cmd, &pr, gs=global_schema_ptr(query_schema), timeout, gt = tracing::global_trace_state_ptr(std::move(trace_state))] (replica::database& db) mutable {
+        account_cross_shard_op(shard);
+        auto f = _db.invoke_on(shard, _read_smp_service_group, [cmd, &pr, gs=global_schema_ptr(query_schema), timeout, gt = tracing::global_trace_state_ptr(std::move(trace_state))] (replica::database& db) mutable {
             return db.query_mutations(gs, *cmd, pr, gt, timeout).then([] (std::tuple<reconcilable_result, cache_temperature> result_ht) {
                 auto&& [result, ht] = result_ht;
                 return make_ready_future<rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature>>(rpc::tuple(make_foreign(make_lw_shared<reconcilable_result>(std::move(result))), std::move(ht)));
             });
         });
+        if (shard == this_shard_id()) {
+            return f;
+        }
+        return f.then([this, shard] (rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature>&& r) {
+            account_cross_shard_bytes(shard, std::get<0>(r)->memory_usage());
+            return std::move(r);
+        });
     } else {
         return query_nonsingular_mutations_locally(std::move(query_schema), std::move(cmd), {pr}, std::move(trace_state), timeout);
     }
@@ -25,6 +25,7 @@
 #include "tracing/trace_state.hh"
 #include <seastar/rpc/rpc_types.hh>
 #include "storage_proxy_stats.hh"
+#include "service/speculative_retry_budget.hh"
 #include "service_permit.hh"
 #include "query/query-result.hh"
 #include "cdc/stats.hh"
@@ -98,6 +99,7 @@ class abstract_read_executor;
 class mutation_holder;
 class client_state;
 class migration_manager;
+class coordinator_read_cache;
 struct hint_wrapper;
 struct batchlog_replay_mutation;
 struct read_repair_mutation;
@@ -335,6 +337,12 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     db::view::node_update_backlog& _max_view_update_backlog;
     updateable_timeout_config& _timeout_config;
     std::unordered_map<locator::host_id, view_update_backlog_timestamped> _view_update_backlogs;
+    // NUMA node of each shard, for accounting cross-NUMA submissions.
+    std::vector<unsigned> _shard_numa_nodes;
+    // Results of reads of hot partitions, see coordinator_read_cache.
+    std::unique_ptr<coordinator_read_cache> _read_cache;
+    // Speculative read retries which adaptive speculative retry may still send.
+    speculative_retry_budget _speculative_retry_budget;
 
     //NOTICE(sarna): This opaque pointer is here just to avoid moving write handler class definitions from .cc to .hh. It's slow path.
     class cancellable_write_handlers_list;
@@ -375,6 +383,8 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     void got_failure_response(response_id_type id, locator::host_id from, size_t count, std::optional<db::view::update_backlog> backlog, error err, std::optional<sstring> msg);
     future<result<>> response_wait(response_id_type id, clock_type::time_point timeout);
     ::shared_ptr<abstract_write_response_handler>& get_write_response_handler(storage_proxy::response_id_type id);
+    // Drops the coordinator read cache entries of a partition which is written.
+    void invalidate_coordinator_read_cache(table_id table, dht::token token) noexcept;
 
     // The `make_write_response_handler` function instantiates a concrete response handler
     // for the given set of replicas.
@@ -431,6 +441,7 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             tracing::trace_state_ptr trace_state,
             const host_id_vector_replica_set& preferred_endpoints,
             bool& is_bounced_read,
+            bool& is_read_off_last_replicas,
             service_permit permit,
             node_local_only node_local_only);
     future<rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>> query_result_local(
@@ -881,6 +892,11 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     stats& get_stats() {
         return scheduling_group_get_specific<storage_proxy_stats::stats>(_stats_key);
     }
+    // Accounts for an operation submitted from the current shard to `shard`.
+    // `bytes` is the size of the payload moved with it, if known.
+    void account_cross_shard_op(shard_id shard, size_t bytes = 0) noexcept;
+    // Accounts for `bytes` moved back from `shard` with the operation's result.
+    void account_cross_shard_bytes(shard_id shard, size_t bytes) noexcept;
     const global_stats& get_global_stats() const {
         return _global_stats;
     }
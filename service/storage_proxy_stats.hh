@@ -97,6 +97,9 @@ struct write_stats {
     // A CQL read query arrived to a non-replica node and was
     // forwarded by a coordinator to a replica
     uint64_t reads_coordinator_outside_replica_set = 0;
+    // A page of a paged read was sent to none of the replicas which served
+    // the previous page, so the queriers they saved could not be resumed
+    uint64_t reads_off_last_replicas = 0;
     uint64_t background_writes = 0; // client no longer waits for the write
     uint64_t throttled_writes = 0; // total number of writes ever delayed due to throttling
     uint64_t throttled_base_writes = 0; // current number of base writes delayed due to view update backlog
@@ -139,6 +142,15 @@ struct stats : public write_stats {
 
     cas_contention_histogram cas_read_contention;
 
+    // reads of hot partitions served from the coordinator read cache, and
+    // ones which missed it
+    uint64_t coordinator_read_cache_hits = 0;
+    uint64_t coordinator_read_cache_misses = 0;
+    // total age of the results served from the coordinator read cache
+    uint64_t coordinator_read_cache_hit_age_ms = 0;
+    // entries dropped because of a write coordinated by this shard
+    uint64_t coordinator_read_cache_invalidations = 0;
+
     uint64_t read_repair_attempts = 0;
     uint64_t read_repair_repaired_blocking = 0;
     uint64_t read_repair_repaired_background = 0;
@@ -160,6 +172,9 @@ struct stats : public write_stats {
     uint64_t replica_mutation_data_reads = 0;
 
     uint64_t replica_cross_shard_ops = 0;
+    // subset of the above which crossed a NUMA node boundary
+    uint64_t replica_cross_numa_ops = 0;
+    uint64_t replica_cross_numa_bytes = 0;
 
     // number of requests that resulted in a stale_topology_exception
     uint64_t replica_fenced_out_requests = 0;
@@ -173,6 +188,7 @@ struct stats : public write_stats {
     uint64_t read_retries = 0; // read is retried with new limit
     uint64_t speculative_digest_reads = 0;
     uint64_t speculative_data_reads = 0;
+    uint64_t speculative_reads_throttled = 0; // over the adaptive speculative retry budget
 
     uint64_t cas_read_unfinished_commit = 0;
     uint64_t cas_foreground = 0;
@@ -336,8 +336,9 @@ static temporary_buffer<char> end_of_partition() {
 // there is another unfiltered after the clustering range, or there is
 // partition end. In the former case, we read the following unfiltered, and
 // deduce the position of the first row of our actual range using
-// row_body_skipping_context::prev_len(). If it's the latter, we find the
-// last row by iterating over the entire last promoted index block.
+// row_body_skipping_context::prev_len(). If it's the latter, we read the
+// entire last promoted index block with a single read and find the last row
+// by iterating over it. The block becomes the initial cached read (see below).
 //
 // After finding the last row, we produce rows in reversed order one by one,
 // parsing current row using row_body_skipping_context, and finding file
@@ -347,7 +348,8 @@ static temporary_buffer<char> end_of_partition() {
 // We skip between clustering ranges using the index_reader's data range.
 // When we detect that the range end has been decreased, we return to the same
 // state as after reading the partition header, and continue as if the new
-// range was the original.
+// range was the original. If the cached read still covers the new range end,
+// the unfiltered following it is parsed from the cache instead of the file.
 //
 // Because vast majority of the data consumed in our parsers is later reused
 // in the sstable reader, we cache the read buffer. The size of the buffer
@@ -482,13 +484,12 @@ class partition_reversing_data_source_impl final : public data_source_impl {
         if (_ir.data_file_positions().end && *_ir.data_file_positions().end < _row_start) {
             // we can skip at least one row
             _row_start = *_ir.data_file_positions().end;
-            if (_cached_read.size() + *_ir.data_file_positions().end >= _row_end) {
-                // we can reuse the cache for the new range
-                _cached_read.trim(_cached_read.size() - (_row_end - *_ir.data_file_positions().end));
-            } else {
-                // we'll need to reset the cache
+            if (_cached_read.size() + _row_start < _row_end) {
+                // the cache doesn't reach the new range, we'll need to reset it
                 _cached_read.trim(0);
             }
+            // Otherwise the cache is kept as is, and trimmed in RANGE_END after
+            // the row following the new range is parsed from it.
             _state = state::RANGE_END;
         }
         switch (_state) {
@@ -507,17 +508,24 @@ class partition_reversing_data_source_impl final : public data_source_impl {
                 }
                 look_in_last_block = true;
             } else {
-                co_await emplace_row_skipping_context(co_await data_stream(_row_start, _row_end), _row_start, _row_end);
+                const uint64_t row_size = _row_end - _row_start;
+                // The row following the range is usually still cached after a skip.
+                auto row_stream = _cached_read.empty()
+                        ? co_await data_stream(_row_start, _row_end)
+                        : seastar::util::as_input_stream(_cached_read.share(_cached_read.size() - row_size, row_size));
+                co_await emplace_row_skipping_context(std::move(row_stream), _row_start, _row_end);
                 co_await _row_skipping_context->consume_input();
                 if (_row_skipping_context->end_of_partition()) {
                     look_in_last_block = true;
                 } else {
+                    if (!_cached_read.empty()) {
+                        _cached_read.trim(_cached_read.size() - row_size);
+                    }
                     _row_end = _row_start;
                     _row_start -= _row_skipping_context->prev_len();
                 }
             }
             if (look_in_last_block) {
-                _cached_read.trim(0);
                 if (auto offset = co_await _ir.last_block_offset()) {
                     // there was a promoted index block in the partition, read from its beginning to find the last row
                     _row_start = _partition_start + *offset;
@@ -525,8 +533,12 @@ class partition_reversing_data_source_impl final : public data_source_impl {
                     // no promoted index blocks in the partition, read from the beginning
                     _row_start = _clustering_range_start;
                 }
+                // Read the whole block at once and find the last row in memory. The block
+                // stays cached, so its rows are returned without reading them again.
+                const uint64_t block_start = _row_start;
+                _cached_read = co_await data_read(block_start, _partition_end);
                 uint64_t last_row_start = _row_start;
-                co_await emplace_row_skipping_context(co_await data_stream(_row_start, _partition_end), _row_start, _partition_end);
+                co_await emplace_row_skipping_context(seastar::util::as_input_stream(_cached_read.share()), _row_start, _partition_end);
                 co_await _row_skipping_context->consume_input();
                 while (!_row_skipping_context->end_of_partition()) {
                     last_row_start = _row_start;
@@ -535,6 +547,8 @@ class partition_reversing_data_source_impl final : public data_source_impl {
                 }
                 _row_end = _row_start;
                 _row_start = last_row_start;
+                // drop the end of partition flag, so that the cache ends at _row_end
+                _cached_read.trim(_row_end - block_start);
                 if (_row_start == _row_end) {
                     // empty partition
                     _state = state::FINISHED;
@@ -76,6 +76,11 @@ class mp_row_consumer_m {
     std::vector<cell> _cells;
     std::optional<collection_mutation_writer> _cm;
 
+    // Columns not selected by _slice, whose values don't have to be read.
+    // Empty unless _slice.allow_column_projection() is set.
+    boost::dynamic_bitset<uint64_t> _projected_out_static_columns;
+    boost::dynamic_bitset<uint64_t> _projected_out_regular_columns;
+
     data_consumer::proceed consume_range_tombstone_start(clustering_key_prefix ck, bound_kind k, tombstone t) {
         sstlog.trace("mp_row_consumer_m {}: consume_range_tombstone_start(ck={}, k={}, t={})", fmt::ptr(this), ck, k, t);
         if (_mf_filter->current_tombstone()) {
@@ -164,6 +169,25 @@ class mp_row_consumer_m {
         _mf_filter.reset();
     }
 
+    static boost::dynamic_bitset<uint64_t> projected_out_columns(size_t count, const query::column_id_vector& selected) {
+        boost::dynamic_bitset<uint64_t> ret(count);
+        ret.set();
+        for (auto id : selected) {
+            ret.reset(id);
+        }
+        return ret;
+    }
+
+    // Evaluates the slice's clustering filter on the serialized clustering key,
+    // so that rejected rows can be skipped without parsing their cells.
+    bool rejected_by_clustering_filter(const std::vector<fragmented_temporary_buffer>& ecp) const {
+        return std::ranges::any_of(_slice.clustering_filter(), [&] (const query::clustering_column_restriction& r) {
+            return r.column >= ecp.size() || !with_linearized(fragmented_temporary_buffer::view(ecp[r.column]), [&] (bytes_view v) {
+                return r.is_satisfied_by(_schema->clustering_column_at(r.column).type->without_reversed(), v);
+            });
+        });
+    }
+
     void check_schema_mismatch(const column_translation::column_info& column_info, const column_definition& column_def) const {
         if (column_info.schema_mismatch) {
             throw_malformed_sstable_exception(
@@ -204,6 +228,10 @@ class mp_row_consumer_m {
             && (!sst->has_scylla_component() || sst->features().is_enabled(sstable_feature::CorrectStaticCompact))) // See #4139
     {
         _cells.reserve(std::max(_schema->static_columns_count(), _schema->regular_columns_count()));
+        if (_slice.allow_column_projection() && !_treat_static_row_as_regular) {
+            _projected_out_static_columns = projected_out_columns(_schema->static_columns_count(), _slice.static_columns);
+            _projected_out_regular_columns = projected_out_columns(_schema->regular_columns_count(), _slice.regular_columns);
+        }
     }
 
     mp_row_consumer_m(mp_row_consumer_reader_mx* reader,
@@ -324,6 +352,12 @@ class mp_row_consumer_m {
 
         switch (res.action) {
         case mutation_fragment_filter::result::emit:
+            if (_slice.has_clustering_filter() && rejected_by_clustering_filter(ecp)) {
+                // Emit the key alone, the query compactor drops the row.
+                sstlog.trace("mp_row_consumer_m {}: rejected by clustering filter", fmt::ptr(this));
+                _reader->push_mutation_fragment(mutation_fragment_v2(*_schema, permit(), *std::exchange(_in_progress_row, {})));
+                return row_processing_result::skip_row;
+            }
             sstlog.trace("mp_row_consumer_m {}: emit", fmt::ptr(this));
             return row_processing_result::do_proceed;
         case mutation_fragment_filter::result::ignore:
@@ -432,6 +466,16 @@ class mp_row_consumer_m {
         return data_consumer::proceed::yes;
     }
 
+    // Cells of projected-out columns are still emitted with an empty value,
+    // so that they keep contributing to row liveness and shadowing.
+    bool skip_column_value(const column_translation::column_info& column_info) const {
+        if (!column_info.id || column_info.is_counter) {
+            return false;
+        }
+        const auto& projected_out = _inside_static_row ? _projected_out_static_columns : _projected_out_regular_columns;
+        return *column_info.id < projected_out.size() && projected_out.test(*column_info.id);
+    }
+
     data_consumer::proceed consume_complex_column_start(const sstables::column_translation::column_info& column_info,
                                                  tombstone tomb) {
         sstlog.trace("mp_row_consumer_m {}: consume_complex_column_start({}, {})", fmt::ptr(this), column_info.id, tomb);
@@ -675,6 +719,7 @@ requires requires(
     { c.consume_complex_column_start(column_info, tomb) } -> std::same_as<data_consumer::proceed>;
     { c.consume_complex_column_end(column_info) } -> std::same_as<data_consumer::proceed>;
     { c.consume_counter_column(column_info, value, timestamp) } -> std::same_as<data_consumer::proceed>;
+    { c.skip_column_value(column_info) } -> std::same_as<bool>;
     { c.consume_range_tombstone(ck_view, kind, tomb) } -> std::same_as<data_consumer::proceed>;
     { c.consume_range_tombstone(ck_view, kind_m, tomb, tomb) } -> std::same_as<data_consumer::proceed>;
     { c.consume_row_end() } -> std::same_as<data_consumer::proceed>;
@@ -1101,6 +1146,16 @@ class data_consume_rows_context_m : public data_consumer::continuous_data_consum
             }
             if (!_column_flags.has_value()) {
                 _column_value = fragmented_temporary_buffer();
+            } else if (_consumer.skip_column_value(get_column_info())) {
+                // The consumer doesn't need the value, step over it using the serialized length.
+                _column_value = fragmented_temporary_buffer();
+                if (!get_column_value_length()) {
+                    co_yield this->read_unsigned_vint(*_processing_data);
+                }
+                auto maybe_skip_bytes = this->skip(*_processing_data, get_column_value_length().value_or(this->_u64));
+                if (std::holds_alternative<skip_bytes>(maybe_skip_bytes)) {
+                    co_yield maybe_skip_bytes;
+                }
             } else {
                 read_status status = read_status::waiting;
                 if (auto len = get_column_value_length()) {
@@ -2194,6 +2249,10 @@ class validating_consumer {
         return data_consumer::proceed::yes;
     }
 
+    bool skip_column_value(const column_translation::column_info&) const {
+        return false;
+    }
+
     data_consumer::proceed consume_range_tombstone(const std::vector<fragmented_temporary_buffer>& ecp, bound_kind kind, tombstone tomb) {
         auto ck = from_fragmented_buffer(ecp);
         _current_pos = position_in_partition(position_in_partition::range_tag_t(), kind, std::move(ck));
@@ -1026,7 +1026,11 @@ time_series_sstable_set::create_single_key_sstable_reader(
         const sstable_predicate& predicate,
         sstables::integrity_check integrity) const {
     const auto& pos = pr.start()->value();
-    // First check if the optimized algorithm for TWCS single partition queries can be applied.
+    auto hash = utils::make_hashed_key(static_cast<bytes_view>(key::from_partition_key(*schema, *pos.key())));
+
+    auto sst_filter = make_sstable_filter(pos, hash, *schema, predicate);
+
+    // Check if the optimized algorithm for TWCS single partition queries can be applied.
     // Multiple conditions must be satisfied:
     // 1. The sstables must be sufficiently modern so they contain the min/max column metadata.
     // 2. The schema cannot have static columns, since we're going to be opening new readers
@@ -1035,13 +1039,18 @@ time_series_sstable_set::create_single_key_sstable_reader(
     // 3. The sstables cannot have partition tombstones for the same reason as above.
     //    TWCS sstables will usually pass this condition.
     // 4. The optimized query path must be enabled.
+    // Conditions 1 and 3 only matter for sstables which may contain the queried partition,
+    // so an sstable holding e.g. partition tombstones of other partitions doesn't force every
+    // read of the table into the standard path. The partition key filter is only checked for
+    // sstables failing them, which are rare with TWCS.
     using sst_entry = std::pair<position_in_partition, shared_sstable>;
     if (!_enable_optimized_twcs_queries
             || schema->has_static_columns()
             || std::any_of(_sstables->begin(), _sstables->end(),
-                [] (const sst_entry& e) {
-                    return e.second->get_version() < sstable_version_types::md
-                        || e.second->may_have_partition_tombstones();
+                [&sst_filter] (const sst_entry& e) {
+                    return (e.second->get_version() < sstable_version_types::md
+                        || e.second->may_have_partition_tombstones())
+                        && sst_filter(*e.second);
     })) {
         // Some of the conditions were not satisfied so we use the standard query path.
         return sstable_set_impl::create_single_key_sstable_reader(
@@ -1049,8 +1058,6 @@ time_series_sstable_set::create_single_key_sstable_reader(
                 pr, slice, std::move(trace_state), fwd_sm, fwd_mr, predicate, integrity);
     }
 
-    auto hash = utils::make_hashed_key(static_cast<bytes_view>(key::from_partition_key(*schema, *pos.key())));
-    auto sst_filter = make_sstable_filter(pos, hash, *schema, predicate);
     auto it = std::find_if(_sstables->begin(), _sstables->end(), [&] (const sst_entry& e) { return sst_filter(*e.second); });
     if (it == _sstables->end()) {
         // No sstables contain data for the queried partition.
@@ -1060,7 +1067,19 @@ time_series_sstable_set::create_single_key_sstable_reader(
     auto& stats = *cf->cf_stats();
     stats.clustering_filter_count++;
 
-    auto create_reader = [schema, permit, &pr, &slice, trace_state, fwd_sm, hash] (sstable& sst) {
+    // Only the sstables the queue actually opens are touched by the read, so
+    // record their number once the read is done, i.e. when the queue (and with
+    // it the reader factory) is destroyed along with the combined reader.
+    struct opened_sstables_recorder {
+        utils::estimated_histogram& histogram;
+        int64_t opened = 0;
+        ~opened_sstables_recorder() {
+            histogram.add(opened);
+        }
+    };
+    auto create_reader = [schema, permit, &pr, &slice, trace_state, fwd_sm, hash,
+            recorder = make_lw_shared<opened_sstables_recorder>(sstable_histogram)] (sstable& sst) {
+        ++recorder->opened;
         return sst.make_reader(schema, permit, pr, slice, trace_state, fwd_sm, mutation_reader::forwarding::yes,
                 default_read_monitor(), integrity_check::no, &hash);
     };
@@ -1071,6 +1090,11 @@ time_series_sstable_set::create_single_key_sstable_reader(
     // We're going to pass this filter into sstable_position_reader_queue. The queue guarantees that
     // the filter is going to be called at most once for each sstable and exactly once after
     // the queue is exhausted. We use that fact to gather statistics.
+    //
+    // The queue walks the sstables in clustering order and calls the filter, and opens readers,
+    // lazily, as the combined reader's position reaches their lower bound. Once the consumer
+    // stops (e.g. the row limit of a "latest N rows" query was reached), sstables further down,
+    // i.e. older time windows, are neither probed nor opened.
     auto filter = [pk_filter = std::move(pk_filter), ck_filter = std::move(ck_filter), &stats]
         (const sstable& sst) {
             if (!pk_filter(sst)) {
@@ -244,6 +244,74 @@ SEASTAR_TEST_CASE(test_reverse_type_aggregation) {
     });
 }
 
+// Aggregates of fixed-width numeric columns are computed over batches of
+// rows. Spans several batches, with nulls and sums overflowing the input type.
+SEASTAR_TEST_CASE(test_batched_aggregates) {
+    return do_with_cql_env_thread([&] (auto& e) {
+        e.execute_cql("CREATE TABLE test (p int, c int, b tinyint, s smallint, i int, l bigint, f float, d double, primary key (p, c))").get();
+
+        int64_t rows = 0;
+        int64_t values = 0;
+        int64_t sum_b = 0;
+        int64_t sum_s = 0;
+        int64_t sum_i = 0;
+        boost::multiprecision::cpp_int sum_l = 0;
+        float sum_f = 0;
+        double sum_d = 0;
+        int32_t min_i = std::numeric_limits<int32_t>::max();
+        int32_t max_i = std::numeric_limits<int32_t>::min();
+        int64_t min_l = std::numeric_limits<int64_t>::max();
+        int64_t max_l = std::numeric_limits<int64_t>::min();
+        for (int32_t c = 0; c < 1000; ++c) {
+            ++rows;
+            if (c % 7 == 0) {
+                e.execute_cql(fmt::format("INSERT INTO test (p, c) VALUES (0, {})", c)).get();
+                continue;
+            }
+            const int8_t b = c % 3 - 1;
+            const int16_t s = c % 20 - 10;
+            const int32_t i = c * 1000 - 400000;
+            const int64_t l = c % 2 ? std::numeric_limits<int64_t>::max() - c : std::numeric_limits<int64_t>::min() / 2 + c;
+            const float f = c * 0.25f;
+            const double d = c * 0.125 - 3;
+            e.execute_cql(fmt::format("INSERT INTO test (p, c, b, s, i, l, f, d) VALUES (0, {}, {}, {}, {}, {}, {}, {})", c, b, s, i, l, f, d)).get();
+            ++values;
+            sum_b += b;
+            sum_s += s;
+            sum_i += i;
+            sum_l += l;
+            sum_f += f;
+            sum_d += d;
+            min_i = std::min(min_i, i);
+            max_i = std::max(max_i, i);
+            min_l = std::min(min_l, l);
+            max_l = std::max(max_l, l);
+        }
+
+        auto msg = e.execute_cql("SELECT count(*), count(i), sum(b), sum(s), sum(i), avg(l), sum(f), avg(d), "
+                                 "min(i), max(i), min(l), max(l) FROM test WHERE p = 0").get();
+        assert_that(msg).is_rows().with_size(1).with_row({{long_type->decompose(rows)},
+                                                          {long_type->decompose(values)},
+                                                          {byte_type->decompose(int8_t(sum_b))},
+                                                          {short_type->decompose(int16_t(sum_s))},
+                                                          {int32_type->decompose(int32_t(sum_i))},
+                                                          {long_type->decompose(boost::multiprecision::cpp_int(sum_l / values).convert_to<int64_t>())},
+                                                          {float_type->decompose(sum_f)},
+                                                          {double_type->decompose(sum_d / values)},
+                                                          {int32_type->decompose(min_i)},
+                                                          {int32_type->decompose(max_i)},
+                                                          {long_type->decompose(min_l)},
+                                                          {long_type->decompose(max_l)}});
+
+        // An empty value sorts before any other, and is aggregated row by row.
+        e.execute_cql("UPDATE test SET i = blobAsInt(0x) WHERE p = 0 AND c = 500").get();
+        msg = e.execute_cql("SELECT min(i), max(i), count(i) FROM test WHERE p = 0").get();
+        assert_that(msg).is_rows().with_size(1).with_row({{bytes()},
+                                                          {int32_type->decompose(max_i)},
+                                                          {long_type->decompose(values)}});
+    });
+}
+
 // Tests #6768
 SEASTAR_TEST_CASE(test_minmax_on_set) {
     return do_with_cql_env_thread([&] (auto& e) {
@@ -25,6 +25,29 @@ using namespace bplus;
 using test_key = tree_test_key_base;
 using test_tree = tree<int, unsigned long, int_compare, 4, key_search::both, with_debug::yes>;
 
+BOOST_AUTO_TEST_CASE(test_array_search) {
+    int64_t array[16];
+    for (int size = 0; size <= 16; size++) {
+        for (int i = 0; i < 16; i++) {
+            array[i] = i < size ? i * 10 : utils::simple_key_unused_value;
+        }
+        for (int64_t val = -5; val <= 165; val += 5) {
+            int expected = std::min<int>(size, val < 0 ? 0 : val / 10 + 1);
+            BOOST_REQUIRE_EQUAL(utils::array_search_gt(val, array, 16, size), expected);
+            BOOST_REQUIRE_EQUAL(utils::array_search_gt<16>(val, array, size), expected);
+        }
+    }
+
+    uint8_t bytes[64];
+    for (int i = 0; i < 64; i++) {
+        bytes[i] = i;
+    }
+    for (int i = 0; i < 64; i++) {
+        BOOST_REQUIRE_EQUAL(utils::array_search_x32_eq(i, bytes, 2), unsigned(i));
+    }
+    BOOST_REQUIRE_EQUAL(utils::array_search_x32_eq(64, bytes, 2), 64u);
+}
+
 BOOST_AUTO_TEST_CASE(test_ops_empty_tree) {
     /* Sanity checks for no nullptr dereferences */
     test_tree t(int_compare{});
@@ -25,6 +25,13 @@ BOOST_AUTO_TEST_CASE(test_caching_options) {
         sstring out_str = co.to_sstring();
         BOOST_REQUIRE_EQUAL(in_str, out_str);
     }
+    {
+        string_map in_map = { {"keys", "ALL"}, {"rows_per_partition", "ALL"}, {"coordinator", "true"}};
+        caching_options co = caching_options::from_map(in_map);
+        BOOST_REQUIRE(co.coordinator_cache_enabled());
+        BOOST_REQUIRE(in_map == co.to_map());
+        BOOST_REQUIRE(!caching_options::from_map({}).coordinator_cache_enabled());
+    }
     {
         sstring in_str = "{\"keys\": \"SOME\", \"rows_per_partition\": \"ALL\"}";
         BOOST_REQUIRE_THROW(caching_options::from_sstring(in_str), std::exception);
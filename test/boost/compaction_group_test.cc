@@ -67,6 +67,7 @@ class single_compaction_group : public compaction::compaction_group_view {
     tombstone_gc_state _tombstone_gc_state;
     compaction::compaction_backlog_tracker _backlog_tracker;
     condition_variable _staging_done_condition;
+    utils::estimated_histogram _sstables_per_read{35};
     std::function<shared_sstable()> _sstable_factory;
     mutable tests::reader_concurrency_semaphore_wrapper _semaphore;
 public:
@@ -131,6 +132,7 @@ class single_compaction_group : public compaction::compaction_group_view {
     virtual seastar::condition_variable& get_staging_done_condition() noexcept override { return _staging_done_condition; }
     dht::token_range get_token_range_after_split(const dht::token& t) const noexcept override { return dht::token_range(); }
     int64_t get_sstables_repaired_at() const noexcept override { return 0; }
+    const utils::estimated_histogram& sstables_per_read_histogram() const noexcept override { return _sstables_per_read; }
 };
 
 SEASTAR_TEST_CASE(basic_compaction_group_splitting_test) {
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include "service/coordinator_read_cache.hh"
+#include "query/query-result.hh"
+#include "test/lib/simple_schema.hh"
+
+#include <seastar/core/sleep.hh>
+#undef SEASTAR_TESTING_MAIN
+#include <seastar/testing/test_case.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+BOOST_AUTO_TEST_SUITE(coordinator_read_cache_test)
+
+using namespace std::chrono_literals;
+using service::coordinator_read_cache;
+
+namespace {
+
+constexpr auto ttl = std::chrono::duration_cast<coordinator_read_cache::clock_type::duration>(1h);
+
+query::read_command make_command(const schema& s, uint64_t row_limit = query::max_rows) {
+    return query::read_command(s.id(), s.version(), s.full_slice(), query::max_result_size(1024 * 1024),
+            query::tombstone_limit::max, query::row_limit(row_limit));
+}
+
+query::result make_result(size_t size, query::short_read sr = query::short_read::no) {
+    bytes_ostream buf;
+    buf.write(bytes(size, int8_t(0x2a)));
+    return query::result(std::move(buf), sr, uint64_t(1), 1, std::nullopt);
+}
+
+void insert(coordinator_read_cache& cache, const query::read_command& cmd, const dht::decorated_key& dk, const query::result& result) {
+    cache.insert(cmd, coordinator_read_cache::command_key(cmd), dk, result, cache.epoch(cmd.cf_id, dk.token()), ttl);
+}
+
+std::optional<coordinator_read_cache::hit> find(coordinator_read_cache& cache, const query::read_command& cmd, const dht::decorated_key& dk,
+        coordinator_read_cache::clock_type::duration entry_ttl = ttl) {
+    return cache.find(cmd, coordinator_read_cache::command_key(cmd), dk, entry_ttl);
+}
+
+} // anonymous namespace
+
+SEASTAR_THREAD_TEST_CASE(test_find_and_insert) {
+    simple_schema ss;
+    auto s = ss.schema();
+    auto pkeys = ss.make_pkeys(2);
+    auto cmd = make_command(*s);
+    coordinator_read_cache cache;
+
+    BOOST_REQUIRE(!find(cache, cmd, pkeys[0]));
+    insert(cache, cmd, pkeys[0], make_result(100));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    auto hit = find(cache, cmd, pkeys[0]);
+    BOOST_REQUIRE(hit);
+    BOOST_REQUIRE_EQUAL(hit->result->buf().size(), 100);
+    BOOST_REQUIRE_EQUAL(*hit->result->row_count(), 1);
+
+    // Other partitions and other commands of the same partition miss.
+    BOOST_REQUIRE(!find(cache, cmd, pkeys[1]));
+    BOOST_REQUIRE(!find(cache, make_command(*s, 1), pkeys[0]));
+
+    // Inserting the same read again replaces its entry.
+    insert(cache, cmd, pkeys[0], make_result(200));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(find(cache, cmd, pkeys[0])->result->buf().size(), 200);
+
+    // Short reads are not cached.
+    insert(cache, cmd, pkeys[1], make_result(100, query::short_read::yes));
+    BOOST_REQUIRE(!find(cache, cmd, pkeys[1]));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_entries_expire) {
+    simple_schema ss;
+    auto s = ss.schema();
+    auto pkey = ss.make_pkey(0);
+    auto cmd = make_command(*s);
+    coordinator_read_cache cache;
+
+    insert(cache, cmd, pkey, make_result(100));
+    BOOST_REQUIRE(find(cache, cmd, pkey, 10ms));
+    seastar::sleep(50ms).get();
+    BOOST_REQUIRE(find(cache, cmd, pkey));
+    BOOST_REQUIRE(!find(cache, cmd, pkey, 10ms));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    BOOST_REQUIRE_EQUAL(cache.memory(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_invalidate) {
+    simple_schema ss;
+    auto s = ss.schema();
+    auto pkeys = ss.make_pkeys(2);
+    auto cmd = make_command(*s);
+    auto other_cmd = make_command(*s, 1);
+    coordinator_read_cache cache;
+
+    insert(cache, cmd, pkeys[0], make_result(100));
+    insert(cache, other_cmd, pkeys[0], make_result(100));
+    insert(cache, cmd, pkeys[1], make_result(100));
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+
+    BOOST_REQUIRE_EQUAL(cache.invalidate(s->id(), pkeys[0].token()), 2);
+    BOOST_REQUIRE(!find(cache, cmd, pkeys[0]));
+    BOOST_REQUIRE(!find(cache, other_cmd, pkeys[0]));
+    BOOST_REQUIRE(find(cache, cmd, pkeys[1]));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(cache.invalidate(s->id(), pkeys[0].token()), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_read_racing_with_write_is_not_cached) {
+    simple_schema ss;
+    auto s = ss.schema();
+    auto pkey = ss.make_pkey(0);
+    auto cmd = make_command(*s);
+    coordinator_read_cache cache;
+
+    // The read misses, then a write of its partition starts before its
+    // result arrives.
+    auto epoch = cache.epoch(s->id(), pkey.token());
+    cache.invalidate(s->id(), pkey.token());
+    cache.insert(cmd, coordinator_read_cache::command_key(cmd), pkey, make_result(100), epoch, ttl);
+    BOOST_REQUIRE(!find(cache, cmd, pkey));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    // A read which started after the write completed is cached.
+    epoch = cache.epoch(s->id(), pkey.token());
+    cache.insert(cmd, coordinator_read_cache::command_key(cmd), pkey, make_result(100), epoch, ttl);
+    BOOST_REQUIRE(find(cache, cmd, pkey));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_limits) {
+    simple_schema ss;
+    auto s = ss.schema();
+    auto pkeys = ss.make_pkeys(3);
+    auto cmd = make_command(*s);
+
+    {
+        coordinator_read_cache cache(2);
+        for (const auto& pk : pkeys) {
+            insert(cache, cmd, pk, make_result(100));
+        }
+        BOOST_REQUIRE_EQUAL(cache.size(), 2);
+        BOOST_REQUIRE(!find(cache, cmd, pkeys[2]));
+    }
+
+    {
+        coordinator_read_cache cache(coordinator_read_cache::default_max_entries, 64 * 1024);
+        insert(cache, cmd, pkeys[0], make_result(40 * 1024));
+        BOOST_REQUIRE(find(cache, cmd, pkeys[0]));
+        BOOST_REQUIRE_GT(cache.memory(), 40 * 1024);
+
+        // Doesn't fit in the remaining memory.
+        insert(cache, cmd, pkeys[1], make_result(40 * 1024));
+        BOOST_REQUIRE(!find(cache, cmd, pkeys[1]));
+        BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+        insert(cache, cmd, pkeys[1], make_result(1024));
+        BOOST_REQUIRE(find(cache, cmd, pkeys[1]));
+
+        cache.invalidate(s->id(), pkeys[0].token());
+        cache.invalidate(s->id(), pkeys[1].token());
+        BOOST_REQUIRE_EQUAL(cache.memory(), 0);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
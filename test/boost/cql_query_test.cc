@@ -59,6 +59,9 @@
 #include "replica/distributed_loader.hh"
 #include "compaction/compaction_manager.hh"
 #include "service/query_state.hh"
+#include "service/mapreduce_service.hh"
+#include "partition_slice_builder.hh"
+#include "cql3/untyped_result_set.hh"
 #include "service_permit.hh"
 #include "service/strong_consistency/coordinator.hh"
 #include "service/strong_consistency/groups_manager.hh"
@@ -5745,6 +5748,119 @@ SEASTAR_TEST_CASE(test_not_parallelized_select_uda) {
     });
 }
 
+static uint64_t ranges_aggregated_locally(cql_test_env& e) {
+    return e.get_mapreduce_service().map_reduce0([] (service::mapreduce_service& mrs) {
+        return mrs.get_stats().ranges_aggregated_locally;
+    }, uint64_t(0), std::plus<uint64_t>()).get();
+}
+
+// Fills a table of a vnode keyspace with partitions with rows, with and
+// without a static row, static-only partitions and partitions whose cells
+// have all expired, or only their static cells.
+static void populate_local_aggregation_pushdown_table(cql_test_env& e) {
+    e.execute_cql("CREATE KEYSPACE vnodes WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1}"
+            " AND tablets = {'enabled': 'false'}").get();
+    e.execute_cql("CREATE TABLE vnodes.tbl (k int, c int, s int static, v int, PRIMARY KEY (k, c))").get();
+    for (int k = 0; k < 50; k++) {
+        for (int c = 0; c < 2; c++) {
+            e.execute_cql(format("INSERT INTO vnodes.tbl (k, c, v) VALUES ({}, {}, {})", k, c, k)).get();
+        }
+        if (k < 10) {
+            e.execute_cql(format("INSERT INTO vnodes.tbl (k, s) VALUES ({}, 1)", k)).get();
+        }
+    }
+    for (int k = 100; k < 110; k++) {
+        e.execute_cql(format("INSERT INTO vnodes.tbl (k, s) VALUES ({}, 1)", k)).get();
+    }
+    for (int k = 200; k < 210; k++) {
+        e.execute_cql(format("INSERT INTO vnodes.tbl (k, c, v) VALUES ({}, 0, 1) USING TTL 100", k)).get();
+    }
+    for (int k = 300; k < 310; k++) {
+        e.execute_cql(format("INSERT INTO vnodes.tbl (k, s) VALUES ({}, 1) USING TTL 100", k)).get();
+    }
+    for (int k = 400; k < 410; k++) {
+        e.execute_cql(format("INSERT INTO vnodes.tbl (k, c, v) VALUES ({}, 0, 1)", k)).get();
+        e.execute_cql(format("UPDATE vnodes.tbl USING TTL 100 SET s = 1 WHERE k = {}", k)).get();
+    }
+    forward_jump_clocks(200s);
+}
+
+// Aggregates the rows of vnodes.tbl with a clustering range no row is in,
+// whose partitions are returned only for their static rows, and only if
+// always_return_static_content is set. It cannot be requested with CQL.
+static int64_t count_static_content(cql_test_env& e, bool always_return_static_content) {
+    auto s = e.local_db().find_schema("vnodes", "tbl");
+    auto slice_builder = partition_slice_builder(*s)
+            .with_range(query::clustering_range::make_singular(clustering_key::from_single_value(*s, int32_type->decompose(5))))
+            .with_option_toggled<query::partition_slice::option::send_timestamp>()
+            .with_option_toggled<query::partition_slice::option::send_expiry>()
+            .with_option<query::partition_slice::option::allow_short_read>();
+    if (always_return_static_content) {
+        slice_builder.with_option<query::partition_slice::option::always_return_static_content>();
+    }
+    query::mapreduce_request req = {
+        .reduction_types = {query::mapreduce_request::reduction_type::count},
+        .cmd = query::read_command(s->id(), s->version(), slice_builder.build(), query::max_result_size(1024 * 1024),
+                query::tombstone_limit::max),
+        .pr = {query::full_partition_range},
+        .cl = db::consistency_level::ONE,
+        .timeout = lowres_system_clock::now() + 10s,
+    };
+    auto res = e.local_qp().mapreduce(std::move(req), nullptr).get();
+    return value_cast<int64_t>(long_type->deserialize(*res.query_results.at(0)));
+}
+
+// Aggregates read from the local replica, without building result pages,
+// must be the same as the ones read through the pager.
+static void test_local_aggregation_pushdown(bool enabled) {
+    auto db_cfg = make_shared<db::config>();
+    db_cfg->enable_parallelized_aggregation({true}, db::config::config_source::CommandLine);
+    db_cfg->enable_local_aggregation_pushdown({enabled}, db::config::config_source::CommandLine);
+    do_with_cql_env_thread([enabled] (cql_test_env& e) {
+        auto& qp = e.local_qp();
+        populate_local_aggregation_pushdown_table(e);
+
+        auto stat_parallelized = qp.get_cql_stats().select_parallelized;
+        auto aggregated_locally = ranges_aggregated_locally(e);
+
+        // Static-only partitions count as a row, expired cells don't.
+        auto msg = e.execute_cql("SELECT count(*), count(v), sum(v), sum(s), min(v), max(v) FROM vnodes.tbl").get();
+        assert_that(msg).is_rows().with_rows({{
+            long_type->decompose(int64_t(120)),
+            long_type->decompose(int64_t(110)),
+            int32_type->decompose(int32_t(2 * (49 * 50 / 2) + 10)),
+            int32_type->decompose(int32_t(30)),
+            int32_type->decompose(int32_t(0)),
+            int32_type->decompose(int32_t(49)),
+        }});
+
+        // Only some of the vnode ranges.
+        msg = e.execute_cql("SELECT count(*) FROM vnodes.tbl WHERE token(k) > -4611686018427387904 AND token(k) <= 4611686018427387904").get();
+        auto rows = cql3::untyped_result_set(e.execute_cql(
+                "SELECT k FROM vnodes.tbl WHERE token(k) > -4611686018427387904 AND token(k) <= 4611686018427387904").get());
+        BOOST_REQUIRE(rows.size() > 0 && rows.size() < 120);
+        assert_that(msg).is_rows().with_rows({{long_type->decompose(int64_t(rows.size()))}});
+
+        BOOST_REQUIRE_EQUAL(count_static_content(e, false), 0);
+        BOOST_REQUIRE_EQUAL(count_static_content(e, true), 20);
+
+        BOOST_CHECK_EQUAL(stat_parallelized + 2, qp.get_cql_stats().select_parallelized);
+        if (enabled) {
+            BOOST_REQUIRE_GT(ranges_aggregated_locally(e), aggregated_locally);
+        } else {
+            BOOST_REQUIRE_EQUAL(ranges_aggregated_locally(e), aggregated_locally);
+        }
+    }, db_cfg).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_local_aggregation_pushdown_enabled) {
+    test_local_aggregation_pushdown(true);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_local_aggregation_pushdown_disabled) {
+    test_local_aggregation_pushdown(false);
+}
+
 cql3::raw_value make_collection_raw_value(size_t size_to_write, const std::vector<cql3::raw_value>& elements_to_write) {
     size_t serialized_len = 0;
     serialized_len += collection_size_len();
@@ -6285,6 +6401,60 @@ SEASTAR_TEST_CASE(test_tablet_routing_info_after_cas_shard_bounce) {
     }());
 }
 
+// With cql_migrate_single_partition_reads, a single-partition read issued on
+// a shard which doesn't own the partition is bounced to the owning shard,
+// where it returns the rows. Without it, the read is served where it was
+// issued.
+SEASTAR_TEST_CASE(test_migrate_single_partition_reads) {
+    BOOST_REQUIRE_GT(this_smp_shard_count(), 1u);
+    auto run = [] (bool migrate) {
+        auto db_config = make_shared<db::config>();
+        db_config->cql_migrate_single_partition_reads.set(migrate);
+        return do_with_cql_env_thread([migrate] (cql_test_env& e) {
+            e.execute_cql("create table t (pk int PRIMARY KEY, v int);").get();
+            auto schema = e.local_db().find_schema("ks", "t");
+
+            // A partition owned by another shard.
+            int32_t pk = 0;
+            unsigned owner;
+            while ((owner = schema->table().shard_for_reads(dht::get_token(*schema, partition_key::from_singular(*schema, pk).view()))) == this_shard_id()) {
+                ++pk;
+            }
+            e.execute_cql(format("insert into t (pk, v) VALUES ({}, 7);", pk)).get();
+            const auto id = e.prepare("select v from t where pk = ?;").get();
+            const auto expected = std::vector<std::vector<bytes_opt>>{{int32_type->decompose(7)}};
+
+            auto res = e.execute_prepared(id, {cql3::raw_value::make_value(int32_type->decompose(pk))}).get();
+            if (!migrate) {
+                assert_that(res).is_rows().with_rows(expected);
+                return;
+            }
+            BOOST_REQUIRE(res->as_bounce());
+            BOOST_REQUIRE(res->as_bounce()->is_read_migration());
+            BOOST_REQUIRE_EQUAL(res->as_bounce()->target_shard(), owner);
+
+            // Simulate the transport-layer bounce, which keeps the shard the
+            // client is connected to as the original shard.
+            const auto gcs = e.local_client_state().move_to_other_shard();
+            smp::submit_to(owner, [&] {
+                return seastar::async([&] {
+                    auto cs = gcs.get();
+                    auto qs = ::make_shared<service::query_state>(cs, empty_service_permit());
+                    const auto prepared = e.local_qp().get_prepared(id);
+                    BOOST_REQUIRE(prepared);
+                    const auto options = e.local_qp().make_internal_options(prepared, {data_value(pk)}, db::consistency_level::ONE);
+                    auto res = e.local_qp().execute_prepared_without_checking_exception_message(
+                        *qs, prepared->statement, options, std::move(prepared), id, false).get();
+                    assert_that(cql_transport::messages::propagate_exception_as_future(std::move(res)).get()).is_rows().with_rows(expected);
+                });
+            }).get();
+        }, cql_test_config(db_config));
+    };
+    return run(false).then([run] {
+        return run(true);
+    });
+}
+
 // check if create statements emit schema change event properly
 // we emit it even if resource wasn't created due to github.com/scylladb/scylladb/issues/16909
 SEASTAR_TEST_CASE(test_schema_change_events) {
@@ -7152,4 +7322,62 @@ SEASTAR_TEST_CASE(test_widening_value_into_wider_sink) {
     });
 }
 
+// Collects the rows passed to a cql3::ResultVisitor, copying the values, which
+// are only valid while they are visited.
+struct collecting_result_visitor {
+    std::vector<std::vector<bytes_opt>> rows;
+
+    void start_row() {
+        rows.emplace_back();
+    }
+    void accept_value(managed_bytes_view_opt value) {
+        rows.back().push_back(value ? bytes_opt(to_bytes(*value)) : std::nullopt);
+    }
+    void end_row() { }
+};
+
+// Rows which need no processing are serialized straight from query::result by
+// result_generator, with views into the keys, which must stay valid while the
+// rows of their partition are visited.
+SEASTAR_TEST_CASE(test_result_generator_keys) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("CREATE TABLE t (p1 text, p2 int, c1 text, c2 int, s text static, v int, PRIMARY KEY ((p1, p2), c1, c2))").get();
+        // Long enough not to be stored inline.
+        const auto p = sstring(64, 'p');
+        const auto c = sstring(64, 'c');
+        const auto st = sstring(64, 's');
+        e.execute_cql(format("INSERT INTO t (p1, p2, c1, c2, s, v) VALUES ('{}', 1, '{}', 1, '{}', 1)", p, c, st)).get();
+        e.execute_cql(format("INSERT INTO t (p1, p2, c1, c2, v) VALUES ('{}', 1, '{}', 2, 2)", p, c)).get();
+        e.execute_cql(format("INSERT INTO t (p1, p2, c1, c2, v) VALUES ('{}', 1, 'c', 1, 3)", p)).get();
+        // Static-only partition.
+        e.execute_cql(format("INSERT INTO t (p1, p2, s) VALUES ('{}', 2, '{}')", p, st)).get();
+
+        auto text = [] (const sstring& v) -> bytes_opt { return utf8_type->decompose(v); };
+        auto i32 = [] (int32_t v) -> bytes_opt { return int32_type->decompose(v); };
+        const auto partition_rows = std::vector<std::vector<bytes_opt>>{
+            {text(p), i32(1), text("c"), i32(1), text(st), i32(3)},
+            {text(p), i32(1), text(c), i32(1), text(st), i32(1)},
+            {text(p), i32(1), text(c), i32(2), text(st), i32(2)},
+        };
+        const auto static_only_row = std::vector<bytes_opt>{text(p), i32(2), std::nullopt, std::nullopt, text(st), std::nullopt};
+
+        auto visit = [&] (sstring query) {
+            auto msg = e.execute_cql(query).get();
+            collecting_result_visitor visitor;
+            dynamic_cast<cql_transport::messages::result_message::rows&>(*msg).rs().visit(visitor);
+            return visitor.rows;
+        };
+
+        BOOST_REQUIRE(visit(format("SELECT p1, p2, c1, c2, s, v FROM t WHERE p1 = '{}' AND p2 = 1", p)) == partition_rows);
+        BOOST_REQUIRE(visit(format("SELECT p1, p2, c1, c2, s, v FROM t WHERE p1 = '{}' AND p2 = 2", p))
+                == std::vector<std::vector<bytes_opt>>{static_only_row});
+
+        // Both partitions in one page.
+        auto rows = partition_rows;
+        rows.push_back(static_only_row);
+        auto msg = e.execute_cql("SELECT p1, p2, c1, c2, s, v FROM t").get();
+        assert_that(msg).is_rows().with_rows_ignore_order(rows);
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
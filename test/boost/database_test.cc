@@ -25,6 +25,7 @@
 #include <fmt/std.h>
 
 #include "test/lib/cql_test_env.hh"
+#include "test/lib/cql_assertions.hh"
 #include "test/lib/result_set_assertions.hh"
 #include "test/lib/log.hh"
 #include "test/lib/random_utils.hh"
@@ -88,6 +89,10 @@ class database_test_wrapper {
     size_t get_total_user_reader_concurrency_semaphore_weight() {
         return _db._reader_concurrency_semaphores_group._total_weight;
     }
+
+    replica::dirty_memory_manager& get_dirty_memory_manager() {
+        return _db._dirty_memory_manager;
+    }
 };
 
 static future<> apply_mutation(sharded<replica::database>& sharded_db, table_id uuid, const mutation& m, bool do_flush = false,
@@ -223,6 +228,94 @@ SEASTAR_TEST_CASE(test_truncate_saves_replay_position) {
     }, cfg);
 }
 
+SEASTAR_TEST_CASE(test_memtable_write_batching) {
+    auto cfg = make_shared<db::config>();
+    cfg->memtable_write_batching.set(true);
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("CREATE TABLE ks.cf (p int, c int, v int, PRIMARY KEY (p, c));").get();
+        auto& db = e.local_db();
+        auto& t = db.find_column_family("ks", "cf");
+        auto s = t.schema();
+
+        // Keys owned by this shard, so that they can be applied here directly.
+        std::vector<int32_t> keys;
+        for (int32_t p = 0; keys.size() < 100; ++p) {
+            if (t.shard_for_reads(dht::get_token(*s, partition_key::from_single_value(*s, int32_type->decompose(p)))) == this_shard_id()) {
+                keys.push_back(p);
+            }
+        }
+        std::vector<frozen_mutation> muts;
+        for (auto p : keys) {
+            mutation m(s, partition_key::from_single_value(*s, int32_type->decompose(p)));
+            m.set_clustered_cell(clustering_key::from_single_value(*s, int32_type->decompose(0)), "v", p, api::new_timestamp());
+            muts.push_back(freeze(m));
+        }
+
+        // Writes issued before the task yields are applied together.
+        parallel_for_each(muts, [&] (const frozen_mutation& fm) {
+            return db.apply(s, fm, tracing::trace_state_ptr(), db::commitlog::force_sync::no, db::no_timeout).discard_result();
+        }).get();
+        BOOST_REQUIRE_GT(t.get_stats().memtable_coalesced_writes, 0);
+
+        for (auto p : keys) {
+            auto res = e.execute_cql(fmt::format("SELECT v FROM ks.cf WHERE p = {} AND c = 0;", p)).get();
+            assert_that(res).is_rows().with_rows({{int32_type->decompose(p)}});
+        }
+    }, cfg);
+}
+
+SEASTAR_TEST_CASE(test_memtable_write_batching_keeps_timeouts) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("CREATE TABLE ks.cf (p int, c int, v int, PRIMARY KEY (p, c));").get();
+        auto& db = e.local_db();
+        auto& t = db.find_column_family("ks", "cf");
+        auto s = t.schema();
+
+        // A key owned by this shard, so that it can be applied here directly.
+        int32_t p = 0;
+        while (t.shard_for_reads(dht::get_token(*s, partition_key::from_single_value(*s, int32_type->decompose(p)))) != this_shard_id()) {
+            ++p;
+        }
+        auto make_write = [&] (int32_t c) {
+            mutation m(s, partition_key::from_single_value(*s, int32_type->decompose(p)));
+            m.set_clustered_cell(clustering_key::from_single_value(*s, int32_type->decompose(c)), "v", c, api::new_timestamp());
+            return freeze(m);
+        };
+        auto guardrails = db::noop_large_data_guardrail::instance();
+
+        auto first = make_write(0);
+        t.apply_coalesced(first, s, db::rp_handle(), db::no_timeout, guardrails).get();
+
+        // Put the memtable under real dirty memory pressure, which blocks
+        // writes without making the flusher kick in.
+        auto& dmm = database_test_wrapper(db).get_dirty_memory_manager();
+        const auto threshold = dmm.throttle_threshold();
+        const auto soft_limit = db.get_config().unspooled_dirty_soft_limit();
+        auto& rg = dmm.region_group();
+        auto restore_limits = defer([&] () noexcept {
+            rg.update_limits(threshold / 2, threshold * soft_limit / 2, threshold);
+        });
+        rg.update_limits(threshold / 2, threshold * soft_limit / 2, 0);
+
+        // Issued in the same task, so they would share a batch, and with it a
+        // deadline, if their timeouts were the same.
+        auto short_write = make_write(1);
+        auto long_write = make_write(2);
+        auto short_f = t.apply_coalesced(short_write, s, db::rp_handle(), db::timeout_clock::now() + 100ms, guardrails);
+        auto long_f = t.apply_coalesced(long_write, s, db::rp_handle(), db::no_timeout, guardrails);
+
+        // The short write times out, rather than waiting as long as the long one.
+        BOOST_REQUIRE_THROW(short_f.get(), seastar::timed_out_error);
+        BOOST_REQUIRE(!long_f.available());
+
+        rg.update_limits(threshold / 2, threshold * soft_limit / 2, threshold);
+        long_f.get();
+
+        auto res = e.execute_cql(fmt::format("SELECT c FROM ks.cf WHERE p = {};", p)).get();
+        assert_that(res).is_rows().with_rows({{int32_type->decompose(0)}, {int32_type->decompose(2)}});
+    });
+}
+
 SEASTAR_TEST_CASE(test_querying_with_limits) {
     return do_with_cql_env_thread([](cql_test_env& e) {
             // FIXME: restore indent.
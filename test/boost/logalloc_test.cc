@@ -830,6 +830,73 @@ SEASTAR_THREAD_TEST_CASE(background_reclaim) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_compact_on_idle_stops_once_reserve_is_met) {
+    prime_segment_pool(memory::stats().total_memory(), memory::min_free_memory()).get();  // if previous test cases muddied the pool
+
+    region r;
+    std::vector<managed_bytes> allocs;
+
+    auto clean_up = defer([&] () noexcept {
+        with_allocator(r.allocator(), [&] {
+            allocs.clear();
+        });
+    });
+
+    // Fill up memory, then free every other object, so that all segments
+    // are half empty and free memory is low.
+    while (true) {
+        try {
+            with_allocator(r.allocator(), [&] {
+                allocs.push_back(managed_bytes(managed_bytes::initialized_later(), 1000));
+            });
+        } catch (std::bad_alloc&) {
+            break;
+        }
+    }
+    with_allocator(r.allocator(), [&] {
+        for (size_t i = 0; i < allocs.size(); i += 2) {
+            allocs[i] = managed_bytes();
+        }
+    });
+    BOOST_REQUIRE_LT(memory::free_memory(), background_reclaim_free_memory_threshold);
+
+    const size_t free_segments = 8;
+    auto no_work = [] { return false; };
+    auto idle_compactions = [] {
+        return shard_tracker().statistics().idle_segments_compacted;
+    };
+
+    // Compacting a half empty segment frees half a segment, so preparing the
+    // reserve takes about twice as many compactions as it has segments,
+    // not a pass over the whole region.
+    auto compacted = idle_compactions();
+    BOOST_REQUIRE(shard_tracker().compact_on_idle(free_segments, no_work) == idle_cpu_handler_result::no_more_work);
+    compacted = idle_compactions() - compacted;
+    BOOST_REQUIRE_GT(compacted, 0);
+    BOOST_REQUIRE_LE(compacted, 4 * free_segments);
+    BOOST_REQUIRE_LT(compacted * segment_size, r.occupancy().total_space() / 4);
+
+    // The reserve is met, there is nothing to do.
+    compacted = idle_compactions();
+    BOOST_REQUIRE(shard_tracker().compact_on_idle(free_segments, no_work) == idle_cpu_handler_result::no_more_work);
+    BOOST_REQUIRE_EQUAL(idle_compactions(), compacted);
+
+    // A reclaim done synchronously with an allocation is counted as such,
+    // and uses up the reserve, which idle compaction then prepares again.
+    auto foreground_reclaims = shard_tracker().statistics().foreground_reclaims;
+    shard_tracker().reclaim(free_segments * segment_size);
+    BOOST_REQUIRE_EQUAL(shard_tracker().statistics().foreground_reclaims, foreground_reclaims + 1);
+    BOOST_REQUIRE_EQUAL(idle_compactions(), compacted);
+    BOOST_REQUIRE(shard_tracker().compact_on_idle(free_segments, no_work) == idle_cpu_handler_result::no_more_work);
+    BOOST_REQUIRE_GT(idle_compactions(), compacted);
+
+    // Interrupted by other work before preparing anything.
+    compacted = idle_compactions();
+    shard_tracker().reclaim(free_segments * segment_size);
+    BOOST_REQUIRE(shard_tracker().compact_on_idle(free_segments, [] { return true; }) == idle_cpu_handler_result::interrupted_by_higher_priority_task);
+    BOOST_REQUIRE_EQUAL(idle_compactions(), compacted);
+}
+
 inline
 bool is_aligned(void* ptr, size_t alignment) {
     return uintptr_t(ptr) % alignment == 0;
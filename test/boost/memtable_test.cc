@@ -237,6 +237,85 @@ SEASTAR_TEST_CASE(test_memtable_flush_reader) {
     });
 }
 
+SEASTAR_TEST_CASE(test_split_memtable_flush_readers) {
+    return seastar::async([] {
+        schema_ptr s = schema_builder(this_smp_shard_count(), "ks", "cf")
+                .with_column("pk", bytes_type, column_kind::partition_key)
+                .with_column("col", bytes_type, column_kind::regular_column)
+                .build();
+
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        replica::table_stats tbl_stats;
+        replica::memtable_table_shared_data table_shared_data;
+        replica::dirty_memory_manager mgr;
+
+        auto mt = make_lw_shared<replica::memtable>(s, mgr, table_shared_data, tbl_stats);
+        auto ring = make_ring(s, 100);
+        for (auto& m : ring) {
+            set_column(m, "col");
+            mt->apply(m);
+        }
+
+        BOOST_REQUIRE_EQUAL(mt->split_for_flush(1).size(), 1u);
+
+        const auto ranges = mt->split_for_flush(4);
+        BOOST_REQUIRE_GT(ranges.size(), 1u);
+        BOOST_REQUIRE_LE(ranges.size(), 4u);
+
+        // Readers of all ranges are created up-front, like a split flush does.
+        std::vector<mutation_reader> readers;
+        for (auto& range : ranges) {
+            readers.push_back(mt->make_flush_reader(s, semaphore.make_permit(), range));
+        }
+        auto it = ring.begin();
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            auto rd = assert_that(std::move(readers[i]));
+            for (; it != ring.end() && ranges[i].contains(it->decorated_key(), dht::ring_position_comparator(*s)); ++it) {
+                rd.produces(*it);
+            }
+            rd.produces_end_of_stream();
+        }
+        BOOST_REQUIRE(it == ring.end());
+    });
+}
+
+SEASTAR_TEST_CASE(test_batch_apply_of_frozen_mutations) {
+    return seastar::async([] {
+        schema_ptr s = schema_builder(this_smp_shard_count(), "ks", "cf")
+                .with_column("pk", bytes_type, column_kind::partition_key)
+                .with_column("col", bytes_type, column_kind::regular_column)
+                .build();
+
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        replica::table_stats tbl_stats;
+        replica::memtable_table_shared_data table_shared_data;
+        replica::dirty_memory_manager mgr;
+
+        auto mt = make_lw_shared<replica::memtable>(s, mgr, table_shared_data, tbl_stats);
+        auto ring = make_ring(s, 100);
+        std::vector<frozen_mutation> frozen;
+        for (auto& m : ring) {
+            set_column(m, "col");
+            frozen.push_back(freeze(m));
+        }
+        // The batch is applied in token order regardless of the order it comes in.
+        std::shuffle(frozen.begin(), frozen.end(), tests::random::gen());
+        auto noop = db::noop_large_data_guardrail::instance();
+        auto batch = frozen | std::views::transform([&] (const frozen_mutation& fm) {
+            return replica::memtable::batch_entry{&fm, {}, noop.get()};
+        }) | std::ranges::to<std::vector>();
+        auto entries = batch | std::views::transform([] (auto& e) { return &e; }) | std::ranges::to<std::vector>();
+        mt->apply(entries, s, *noop);
+        BOOST_REQUIRE(std::ranges::all_of(batch, &replica::memtable::batch_entry::applied));
+
+        auto rd = assert_that(mt->make_mutation_reader(s, semaphore.make_permit()));
+        for (auto& m : ring) {
+            rd.produces(m);
+        }
+        rd.produces_end_of_stream();
+    });
+}
+
 SEASTAR_TEST_CASE(test_adding_a_column_during_reading_doesnt_affect_read_result) {
     return seastar::async([] {
         auto common_builder = schema_builder(this_smp_shard_count(), "ks", "cf")
@@ -565,6 +565,62 @@ SEASTAR_THREAD_TEST_CASE(test_result_size_calculation) {
     BOOST_REQUIRE_EQUAL(digest_only_builder.memory_accounter().used_memory(), result_and_digest_builder.memory_accounter().used_memory());
 }
 
+// Rows rejected by the clustering filter are either stored in full (memtables)
+// or emitted with their key only (sstables, cache). The result, including where
+// the tombstone limit cuts the page, must be the same either way.
+SEASTAR_THREAD_TEST_CASE(test_clustering_filter_result_does_not_depend_on_source_layout) {
+    tests::reader_concurrency_semaphore_wrapper semaphore;
+    auto s = make_schema();
+    const auto& v1 = *s->get_column_definition("v1");
+    auto pk = partition_key::from_single_value(*s, "key1");
+    auto make_ck = [&] (int i) {
+        return clustering_key::from_single_value(*s, to_bytes(seastar::format("ck{:02}", i)));
+    };
+
+    mutation full(s, pk);
+    mutation stripped(s, pk);
+    for (int i = 0; i < 20; ++i) {
+        full.set_clustered_cell(make_ck(i), v1, atomic_cell::make_live(*v1.type, 1, bytes("v")));
+        if (i == 10) {
+            stripped.set_clustered_cell(make_ck(i), v1, atomic_cell::make_live(*v1.type, 1, bytes("v")));
+        } else {
+            stripped.partition().clustered_row(*s, make_ck(i));
+        }
+    }
+
+    auto slice = make_full_slice(*s);
+    slice.options.set<query::partition_slice::option::allow_short_read>();
+    slice.set_clustering_filter({{0, query::clustering_column_restriction::op::eq, {make_ck(10).explode().front()}}});
+
+    auto query = [&] (const mutation& m, uint64_t tombstone_limit) {
+        query::result_memory_limiter l(std::numeric_limits<ssize_t>::max());
+        query::result::builder builder(slice, query::result_options{query::result_request::result_and_digest, query::digest_algorithm::xxHash},
+                l.new_data_read(query::max_result_size(query::result_memory_limiter::maximum_result_size), query::short_read::yes).get(), tombstone_limit);
+        data_query(s, semaphore.make_permit(), make_source({m}), query::full_partition_range, slice, builder);
+        return builder.build();
+    };
+
+    for (const uint64_t tombstone_limit : {query::max_tombstones, uint64_t(5)}) {
+        auto full_result = query(full, tombstone_limit);
+        auto stripped_result = query(stripped, tombstone_limit);
+        BOOST_REQUIRE(full_result.digest() == stripped_result.digest());
+        BOOST_REQUIRE_EQUAL(bool(full_result.is_short_read()), bool(stripped_result.is_short_read()));
+
+        auto rs = query::result_set::from_raw_result(s, slice, full_result);
+        if (tombstone_limit == query::max_tombstones) {
+            BOOST_REQUIRE(!full_result.is_short_read());
+            assert_that(rs).has_only(a_row()
+                    .with_column("pk", data_value(bytes("key1")))
+                    .with_column("ck", data_value(bytes("ck10")))
+                    .with_column("v1", data_value(bytes("v"))));
+        } else {
+            // Rejected rows count towards the tombstone limit.
+            BOOST_REQUIRE(full_result.is_short_read());
+            assert_that(rs).is_empty();
+        }
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(test_frozen_mutation_consumer) {
     random_mutation_generator gen(random_mutation_generator::generate_counters::no);
     schema_ptr s = gen.schema();
@@ -3185,6 +3185,39 @@ SEASTAR_THREAD_TEST_CASE(test_appending_hash_row_4567) {
     BOOST_CHECK_NE(compute_hash(r2, { 0, 1, 2 }), compute_hash(r3, { 0, 1, 2 }));
 }
 
+SEASTAR_THREAD_TEST_CASE(test_appending_hash_row_reuses_prepared_hashes) {
+    auto s = schema_builder(this_smp_shard_count(), "ks", "cf")
+        .with_column("pk", bytes_type, column_kind::partition_key)
+        .with_column("ck", bytes_type, column_kind::clustering_key)
+        .with_column("r1", bytes_type)
+        .with_column("r2", bytes_type)
+        .build();
+
+    auto r = row();
+    r.append_cell(0, atomic_cell::make_live(*bytes_type, 1, to_bytes("aaa")));
+    r.append_cell(1, atomic_cell::make_live(*bytes_type, 1, to_bytes("bbb")));
+
+    auto compute_hash = [&] (const row& r) {
+        auto hasher = xx_hasher{};
+        max_timestamp ts;
+        appending_hash<row>{}(hasher, r, *s, column_kind::regular_column, { 0, 1 }, ts);
+        return hasher.finalize_uint64();
+    };
+
+    auto before = row::get_hash_stats();
+    auto unprepared = compute_hash(r);
+    BOOST_CHECK_EQUAL(row::get_hash_stats().computed - before.computed, 2);
+
+    r.prepare_hash(*s, column_kind::regular_column);
+    r.prepare_hash(*s, column_kind::regular_column);
+    BOOST_CHECK_EQUAL(row::get_hash_stats().computed - before.computed, 4);
+    BOOST_CHECK_EQUAL(row::get_hash_stats().cached - before.cached, 2);
+
+    // Hashing a prepared row doesn't hash its cells again, and gives the same digest.
+    BOOST_CHECK_EQUAL(compute_hash(r), unprepared);
+    BOOST_CHECK_EQUAL(row::get_hash_stats().computed - before.computed, 4);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_mutation_consume) {
     std::mt19937 engine(tests::random::get_int<uint32_t>());
 
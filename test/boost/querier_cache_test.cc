@@ -366,6 +366,16 @@ class test_querier_cache {
         return *this;
     }
 
+    test_querier_cache& no_hits() {
+        BOOST_REQUIRE_EQUAL(_cache.get_stats().hits, _expected_stats.hits);
+        return *this;
+    }
+
+    test_querier_cache& hits() {
+        BOOST_REQUIRE_EQUAL(_cache.get_stats().hits, ++_expected_stats.hits);
+        return *this;
+    }
+
     test_querier_cache& no_drops() {
         BOOST_REQUIRE_EQUAL(_cache.get_stats().drops, _expected_stats.drops);
         return *this;
@@ -411,11 +421,13 @@ SEASTAR_THREAD_TEST_CASE(lookup_data_querier_as_mutation_querier_misses) {
     const auto entry = t.produce_first_page_and_save_data_querier();
     t.assert_cache_lookup_mutation_querier(entry.key, *t.get_schema(), entry.expected_range, entry.expected_slice)
         .misses()
+        .no_hits()
         .no_drops()
         .no_evictions();
 
     t.assert_cache_lookup_data_querier(entry.key, *t.get_schema(), entry.expected_range, entry.expected_slice)
         .no_misses()
+        .hits()
         .no_drops()
         .no_evictions();
 }
@@ -443,11 +455,13 @@ SEASTAR_THREAD_TEST_CASE(data_and_mutation_querier_can_coexist) {
 
     t.assert_cache_lookup_data_querier(data_entry.key, *t.get_schema(), data_entry.expected_range, data_entry.expected_slice)
         .no_misses()
+        .hits()
         .no_drops()
         .no_evictions();
 
     t.assert_cache_lookup_mutation_querier(mutation_entry.key, *t.get_schema(), mutation_entry.expected_range, mutation_entry.expected_slice)
         .no_misses()
+        .hits()
         .no_drops()
         .no_evictions();
 }
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include "replica/read_coalescer.hh"
+#include "query/query-result.hh"
+#include "types/types.hh"
+
+#include <seastar/core/timed_out_error.hh>
+#undef SEASTAR_TESTING_MAIN
+#include <seastar/testing/test_case.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+BOOST_AUTO_TEST_SUITE(read_coalescer_test)
+
+using namespace std::chrono_literals;
+using replica::read_coalescer;
+
+namespace {
+
+const auto table = table_id::create_random_id();
+// Tokens hashing into different write epoch buckets.
+const auto token = dht::token(int64_t(1) << 56);
+const auto other_token = dht::token(int64_t(2) << 56);
+
+read_coalescer::read_key make_key(dht::token t = token) {
+    return read_coalescer::read_key{to_bytes("read"), table, t};
+}
+
+read_coalescer::result_ptr make_result(sstring data) {
+    bytes_ostream buf;
+    buf.write(to_bytes_view(data));
+    return make_lw_shared<query::result>(std::move(buf), query::short_read::no, uint64_t(1), 1, std::nullopt);
+}
+
+bytes result_data(const query::result& result) {
+    return to_bytes(result.buf().view());
+}
+
+auto far_future() {
+    return db::timeout_clock::now() + 1h;
+}
+
+} // anonymous namespace
+
+SEASTAR_THREAD_TEST_CASE(test_identical_reads_share_the_result) {
+    read_coalescer coalescer;
+
+    BOOST_REQUIRE(!coalescer.wait(make_key(), far_future()));
+    auto leader = coalescer.lead(make_key());
+    BOOST_REQUIRE(leader);
+    // Only one leader for identical reads at a time.
+    BOOST_REQUIRE(!coalescer.lead(make_key()));
+
+    auto f1 = coalescer.wait(make_key(), far_future());
+    auto f2 = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(f1 && f2);
+
+    auto result = make_result("result");
+    leader->resolve(result);
+    auto r1 = f1->get();
+    auto r2 = f2->get();
+    // Every follower gets its own copy.
+    BOOST_REQUIRE(r1.get() != result.get() && r2.get() != result.get() && r1.get() != r2.get());
+    BOOST_REQUIRE_EQUAL(result_data(*r1), result_data(*result));
+    BOOST_REQUIRE_EQUAL(result_data(*r2), result_data(*result));
+
+    BOOST_REQUIRE_EQUAL(coalescer.get_stats().leaders, 1);
+    BOOST_REQUIRE_EQUAL(coalescer.get_stats().coalesced, 2);
+
+    // Reads arriving after the result is ready don't share it.
+    BOOST_REQUIRE(!coalescer.wait(make_key(), far_future()));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_leader_failure) {
+    read_coalescer coalescer;
+
+    auto leader = coalescer.lead(make_key());
+    auto f = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(f);
+
+    // The leader fails without resolving.
+    leader.reset();
+    BOOST_REQUIRE_THROW(f->get(), std::runtime_error);
+
+    // The follower executes on its own, and may lead identical reads.
+    BOOST_REQUIRE(!coalescer.wait(make_key(), far_future()));
+    auto fallback = coalescer.lead(make_key());
+    BOOST_REQUIRE(fallback);
+    f = coalescer.wait(make_key(), far_future());
+    fallback->resolve(make_result("result"));
+    BOOST_REQUIRE_EQUAL(result_data(*f->get()), to_bytes("result"));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_follower_timeout) {
+    read_coalescer coalescer;
+
+    auto leader = coalescer.lead(make_key());
+    auto timing_out = coalescer.wait(make_key(), db::timeout_clock::now() + 10ms);
+    auto waiting = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(timing_out && waiting);
+
+    BOOST_REQUIRE_THROW(timing_out->get(), seastar::timed_out_error);
+
+    // Other followers and the leader are not affected.
+    leader->resolve(make_result("result"));
+    BOOST_REQUIRE_EQUAL(result_data(*waiting->get()), to_bytes("result"));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_write_ends_sharing) {
+    read_coalescer coalescer;
+
+    auto leader = coalescer.lead(make_key());
+    auto before_write = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(before_write);
+
+    // Writes of other partitions don't matter.
+    coalescer.on_write(table, other_token);
+    auto after_other_write = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(after_other_write);
+
+    // A read arriving after a write of the partition completed must not be
+    // served by a read which started before it. It executes on its own and
+    // leads reads arriving later.
+    coalescer.on_write(table, token);
+    BOOST_REQUIRE(!coalescer.wait(make_key(), far_future()));
+    auto new_leader = coalescer.lead(make_key());
+    BOOST_REQUIRE(new_leader);
+    auto after_write = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(after_write);
+
+    // Resolving the superseded leader doesn't end sharing of the new one.
+    leader->resolve(make_result("before"));
+    BOOST_REQUIRE_EQUAL(result_data(*before_write->get()), to_bytes("before"));
+    BOOST_REQUIRE_EQUAL(result_data(*after_other_write->get()), to_bytes("before"));
+    auto late = coalescer.wait(make_key(), far_future());
+    BOOST_REQUIRE(late);
+
+    new_leader->resolve(make_result("after"));
+    BOOST_REQUIRE_EQUAL(result_data(*after_write->get()), to_bytes("after"));
+    BOOST_REQUIRE_EQUAL(result_data(*late->get()), to_bytes("after"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -846,6 +846,26 @@ SEASTAR_THREAD_TEST_CASE(multi_eq_on_primary) {
     }).get();
 }
 
+SEASTAR_THREAD_TEST_CASE(prepared_point_lookup) {
+    do_with_cql_env_thread([](cql_test_env& e) {
+        cquery_nofail(e, "create table t (pk1 int, pk2 int, ck1 int, ck2 int, r int, primary key ((pk1, pk2), ck1, ck2))"
+                         " with clustering order by (ck1 asc, ck2 desc)");
+        cquery_nofail(e, "insert into t (pk1, pk2, ck1, ck2, r) values (1, 2, 3, 4, 5)");
+        cquery_nofail(e, "insert into t (pk1, pk2, ck1, ck2, r) values (1, 2, 3, 40, 50)");
+        cquery_nofail(e, "insert into t (pk1, pk2, ck1, ck2, r) values (1, 20, 3, 4, 500)");
+        const auto by_pk = e.prepare("select r from t where pk2 = ? and pk1 = ?").get();
+        require_rows(e, by_pk, {}, {I(2), I(1)}, {{I(5)}, {I(50)}});
+        require_rows(e, by_pk, {}, {I(20), I(1)}, {{I(500)}});
+        require_rows(e, by_pk, {}, {I(3), I(1)}, {});
+        const auto by_key = e.prepare("select r from t where pk1 = ? and pk2 = ? and ck2 = ? and ck1 = ?").get();
+        require_rows(e, by_key, {}, {I(1), I(2), I(40), I(3)}, {{I(50)}});
+        require_rows(e, by_key, {}, {I(1), I(2), I(41), I(3)}, {});
+        const auto by_prefix = e.prepare("select r from t where pk1 = 1 and pk2 = ? and ck1 = ?").get();
+        require_rows(e, by_prefix, {}, {I(2), I(3)}, {{I(5)}, {I(50)}});
+        require_rows(e, by_prefix, {}, {I(20), I(4)}, {});
+    }).get();
+}
+
 SEASTAR_THREAD_TEST_CASE(token) {
     do_with_cql_env_thread([](cql_test_env& e) {
         cquery_nofail(e, "create table t (p int, q int, r int, primary key ((p, q)))");
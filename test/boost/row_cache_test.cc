@@ -276,6 +276,65 @@ SEASTAR_TEST_CASE(test_cache_uses_continuity_info_for_single_partition_query) {
     });
 }
 
+SEASTAR_TEST_CASE(test_clustering_filter_is_not_applied_to_population) {
+    return seastar::async([] {
+        simple_schema ss;
+        auto s = ss.schema();
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+
+        auto pk = ss.make_pkey();
+        mutation m(s, pk);
+        for (auto&& ck : ss.make_ckeys(10)) {
+            ss.add_row(m, ck, "v");
+        }
+
+        int secondary_calls_count = 0;
+        bool underlying_saw_filter = false;
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source_from_snapshot(mutation_source([&] (
+                schema_ptr s,
+                reader_permit permit,
+                const dht::partition_range& range,
+                const query::partition_slice& slice,
+                tracing::trace_state_ptr,
+                streamed_mutation::forwarding fwd) {
+            underlying_saw_filter |= slice.has_clustering_filter();
+            return make_counting_reader(make_mutation_reader_from_mutations(s, std::move(permit), m, slice, std::move(fwd)), secondary_calls_count);
+        })), tracker);
+
+        auto range = dht::partition_range::make_singular(pk);
+        auto slice = s->full_slice();
+        slice.set_clustering_filter({{0, query::clustering_column_restriction::op::eq, {ss.make_ckey(3).explode().front()}}});
+
+        // Rejected rows are emitted with their key only.
+        auto assert_filtered = [&] (mutation_reader_assertions&& a) {
+            a.produces_partition_start(pk);
+            for (int i = 0; i < 10; ++i) {
+                if (i == 3) {
+                    a.produces_row_with_key(ss.make_ckey(i));
+                } else {
+                    a.produces_row(ss.make_ckey(i), std::vector<mutation_reader_assertions::expected_column>());
+                }
+            }
+            a.produces_partition_end().produces_end_of_stream();
+        };
+
+        assert_filtered(assert_that(cache.make_reader(s, semaphore.make_permit(), range, slice)));
+        BOOST_REQUIRE(!underlying_saw_filter);
+        BOOST_REQUIRE_EQUAL(secondary_calls_count, 1);
+
+        // The filtered read must have populated the whole partition.
+        assert_that(cache.make_reader(s, semaphore.make_permit(), range))
+            .produces(m)
+            .produces_end_of_stream();
+        BOOST_REQUIRE_EQUAL(secondary_calls_count, 1);
+
+        // Rows served from cache are filtered as well.
+        assert_filtered(assert_that(cache.make_reader(s, semaphore.make_permit(), range, slice)));
+        BOOST_REQUIRE_EQUAL(secondary_calls_count, 1);
+    });
+}
+
 void test_cache_delegates_to_underlying_only_once_with_single_partition(schema_ptr s,
                                                                         tests::reader_concurrency_semaphore_wrapper& semaphore,
                                                                         const mutation& m,
@@ -85,6 +85,84 @@ SEASTAR_TEST_CASE(test_secondary_index_clustering_key_query) {
     });
 }
 
+// Base rows of index keys that belong to the same partition are read
+// together; check that all of them are returned, also with a reversed
+// clustering order.
+SEASTAR_TEST_CASE(test_secondary_index_rows_of_same_partition) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, v int, PRIMARY KEY (p, c)) WITH CLUSTERING ORDER BY (c DESC)");
+        cquery_nofail(e, "CREATE INDEX ON t (v)");
+        std::vector<std::vector<bytes_opt>> expected;
+        for (int p = 0; p < 3; ++p) {
+            for (int c = 0; c < 10; ++c) {
+                cquery_nofail(e, fmt::format("INSERT INTO t (p, c, v) VALUES ({}, {}, {})", p, c, c % 2));
+                if (c % 2 == 0) {
+                    expected.push_back({int32_type->decompose(p), int32_type->decompose(c)});
+                }
+            }
+        }
+        eventually([&] {
+            auto msg = cquery_nofail(e, "SELECT p, c FROM t WHERE v = 0");
+            assert_that(msg).is_rows().with_rows_ignore_order(expected);
+        });
+    });
+}
+
+// An index can include regular columns of the base table, so that queries
+// selecting only them, the base primary key and the indexed column are
+// answered from the index view. The results must be the same as the ones
+// read from the base table, also when paged.
+SEASTAR_TEST_CASE(test_secondary_index_included_columns) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, v int, w int, x int, s int static, PRIMARY KEY (p, c))");
+        cquery_nofail(e, "CREATE INDEX ON t (v) WITH options = {'included_columns': 'w'}");
+        for (int p = 0; p < 3; ++p) {
+            for (int c = 0; c < 3; ++c) {
+                cquery_nofail(e, fmt::format("INSERT INTO t (p, c, v, w, x) VALUES ({}, {}, {}, {}, {})", p, c, c % 2, p * 10 + c, -c));
+            }
+        }
+        auto row = [] (int p, int c, int w) {
+            return std::vector<bytes_opt>{int32_type->decompose(p), int32_type->decompose(c), int32_type->decompose(w)};
+        };
+        eventually([&] {
+            auto msg = cquery_nofail(e, "SELECT p, c, w FROM t WHERE v = 0");
+            assert_that(msg).is_rows().with_rows_ignore_order({row(0, 0, 0), row(0, 2, 2), row(1, 0, 10), row(1, 2, 12), row(2, 0, 20), row(2, 2, 22)});
+        });
+        // Not covered: x is not included, and is read from the base table.
+        auto msg = cquery_nofail(e, "SELECT p, c, x FROM t WHERE v = 1");
+        assert_that(msg).is_rows().with_rows_ignore_order({row(0, 1, -1), row(1, 1, -1), row(2, 1, -1)});
+        msg = cquery_nofail(e, "SELECT w FROM t WHERE v = 1 AND p = 2");
+        assert_that(msg).is_rows().with_rows({{int32_type->decompose(21)}});
+
+        std::vector<std::vector<bytes_opt>> paged;
+        lw_shared_ptr<service::pager::paging_state> paging_state;
+        do {
+            auto qo = std::make_unique<cql3::query_options>(db::consistency_level::LOCAL_ONE, std::vector<cql3::raw_value>{},
+                    cql3::query_options::specific_options{1, paging_state, {}, api::new_timestamp()});
+            auto res = e.execute_cql("SELECT p, c, w FROM t WHERE v = 0", std::move(qo)).get();
+            auto rows = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(res);
+            for (const auto& r : rows->rs().result_set().rows()) {
+                paged.push_back(r | std::views::transform([] (const managed_bytes_opt& v) { return to_bytes_opt(v); }) | std::ranges::to<std::vector>());
+            }
+            auto state = rows->rs().get_metadata().paging_state();
+            paging_state = state ? make_lw_shared<service::pager::paging_state>(*state) : nullptr;
+        } while (paging_state);
+        auto unpaged = cquery_nofail(e, "SELECT p, c, w FROM t WHERE v = 0");
+        assert_that(unpaged).is_rows().with_rows(paged);
+
+        // The option is validated against the base schema.
+        cquery_nofail(e, "CREATE TABLE t2 (p int, c int, v int, w int, s int static, l list<int>, PRIMARY KEY (p, c))");
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (v) WITH options = {'included_columns': 'nope'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (v) WITH options = {'included_columns': 'v'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (v) WITH options = {'included_columns': 'c'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (v) WITH options = {'included_columns': 's'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (v) WITH options = {'included_columns': 'w, w'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 ((p), v) WITH options = {'included_columns': 'w'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (l) WITH options = {'included_columns': 'w'}"));
+        assert_that_failed(e.execute_cql("CREATE INDEX ON t2 (v) WITH options = {'included_columns': 'w', 'other': 'x'}"));
+    });
+}
+
 // If there is a single partition key column, creating an index on this
 // column is not necessary - it is already indexed as the partition key!
 // So Scylla, as does Cassandra, forbids it. The user should just drop
@@ -1278,6 +1356,29 @@ static cql_test_config test_config_with_small_internal_page_size() {
     return cfg;
 }
 
+// secondary_index_base_read_concurrency limits the base table reads of both
+// indexes returning partitions, of a table without clustering key, and indexes
+// returning rows.
+SEASTAR_TEST_CASE(test_secondary_index_base_read_concurrency) {
+    cql_test_config cfg;
+    cfg.db_config->secondary_index_base_read_concurrency.set(3);
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE by_partition (p int PRIMARY KEY, v int)");
+        cquery_nofail(e, "CREATE INDEX ON by_partition(v)");
+        cquery_nofail(e, "CREATE TABLE by_row (p int, c int, v int, PRIMARY KEY (p, c))");
+        cquery_nofail(e, "CREATE INDEX ON by_row(v)");
+        const int count = 100;
+        for (int i = 0; i < count; i++) {
+            cquery_nofail(e, format("INSERT INTO by_partition (p, v) VALUES ({}, 1)", i));
+            cquery_nofail(e, format("INSERT INTO by_row (p, c, v) VALUES ({}, {}, 1)", i % 10, i));
+        }
+        eventually([&] {
+            assert_that(cquery_nofail(e, "SELECT p FROM by_partition WHERE v = 1")).is_rows().with_size(count);
+            assert_that(cquery_nofail(e, "SELECT p, c FROM by_row WHERE v = 1")).is_rows().with_size(count);
+        });
+    }, std::move(cfg));
+}
+
 SEASTAR_TEST_CASE(test_secondary_index_on_ck_first_column_and_aggregation) {
     // Tests aggregation on table with secondary index on first column
     // of clustering key. This is the "partition_slices" case of 
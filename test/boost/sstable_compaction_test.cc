@@ -5612,20 +5612,27 @@ void test_twcs_single_key_reader_filtering_fn(test_env& env) {
                     query::clustering_range::bound { clustering_key_prefix::from_single_value(*s, int32_type->decompose(1)) },
                 }).build();
 
-    auto reader = set.create_single_key_sstable_reader(
-            &*cf, s, permit, eh, pr, slice,
-            tracing::trace_state_ptr(), ::streamed_mutation::forwarding::no,
-            ::mutation_reader::forwarding::no);
-    auto close_reader = deferred_close(reader);
-
     auto& cf_stats = cf.cf_stats();
     auto checked_by_ck = cf_stats.sstables_checked_by_clustering_filter;
     auto surviving_after_ck = cf_stats.surviving_sstables_after_clustering_filter;
 
-    // consume all fragments
-    while (reader().get());
+    {
+        auto reader = set.create_single_key_sstable_reader(
+                &*cf, s, permit, eh, pr, slice,
+                tracing::trace_state_ptr(), ::streamed_mutation::forwarding::no,
+                ::mutation_reader::forwarding::no);
+        auto close_reader = deferred_close(reader);
 
-    // At least sst2 should be checked by the CK filter during fragment consumption and should pass.
+        // consume all fragments
+        while (reader().get());
+    }
+
+    // Both sstables contain rows in the queried range, so both are read.
+    // The read is recorded once the reader is gone, with the sstables it opened.
+    BOOST_REQUIRE_EQUAL(eh.count(), 1);
+    BOOST_REQUIRE_EQUAL(eh.max(), 2);
+
+    // At least sst2 should be checked by the CK filter and should pass.
     // With the bug in #8432, sst2 wouldn't even be checked by the CK filter since it would pass right after checking the PK filter.
     BOOST_REQUIRE_GE(cf_stats.sstables_checked_by_clustering_filter - checked_by_ck, 1);
     BOOST_REQUIRE_EQUAL(
@@ -5647,6 +5654,82 @@ SEASTAR_FIXTURE_TEST_CASE(test_twcs_single_key_reader_filtering_gcs, gcs_fixture
                                    test_env_config{.storage = make_test_object_storage_options("GS")});
 }
 
+SEASTAR_TEST_CASE(test_twcs_single_key_reader_partition_tombstones_of_other_keys) {
+    return test_env::do_with_async([](test_env& env) {
+        auto builder = schema_builder(this_smp_shard_count(), "tests", "twcs_single_key_reader_partition_tombstones")
+                .with_column("pk", int32_type, column_kind::partition_key)
+                .with_column("ck", int32_type, column_kind::clustering_key)
+                .with_column("v", int32_type);
+        builder.set_compaction_strategy(compaction::compaction_strategy_type::time_window);
+        auto s = builder.build();
+
+        auto sst_gen = env.make_sst_factory(s);
+
+        auto make_row = [&] (int32_t pk, int32_t ck) {
+            mutation m(s, partition_key::from_single_value(*s, int32_type->decompose(pk)));
+            m.set_clustered_cell(clustering_key::from_single_value(*s, int32_type->decompose(ck)), to_bytes("v"), int32_t(0), api::new_timestamp());
+            return m;
+        };
+        // Older than the rows, so that it doesn't shadow them.
+        auto make_partition_tombstone = [&] (int32_t pk) {
+            mutation m(s, partition_key::from_single_value(*s, int32_type->decompose(pk)));
+            m.partition().apply(tombstone(api::min_timestamp, gc_clock::now()));
+            return m;
+        };
+
+        auto sst1 = make_sstable_containing(sst_gen, {make_row(0, 0)}).get();
+        auto sst2 = make_sstable_containing(sst_gen, {make_row(0, 1)}).get();
+        auto other_key_tombstone = make_sstable_containing(sst_gen, {make_partition_tombstone(1)}).get();
+        BOOST_REQUIRE(other_key_tombstone->may_have_partition_tombstones());
+        auto dkey = sst1->get_first_decorated_key();
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+        cf->start();
+
+        auto cs = compaction::make_compaction_strategy(compaction::compaction_strategy_type::time_window, {});
+
+        auto set = cs.make_sstable_set(cf.as_compaction_group_view());
+        set.insert(std::move(sst1));
+        set.insert(std::move(sst2));
+        set.insert(other_key_tombstone);
+
+        reader_permit permit = env.make_reader_permit();
+        utils::estimated_histogram eh;
+        auto pr = dht::partition_range::make_singular(dkey);
+        auto slice = partition_slice_builder(*s).build();
+        auto& cf_stats = cf.cf_stats();
+
+        // The standard path filters sstables by clustering key up front, taking
+        // the fast path for a full clustering range. The optimized one filters
+        // them lazily and never takes it.
+        auto read_on_standard_path = [&] (int expected_rows) {
+            auto fast_path_count = cf_stats.clustering_filter_fast_path_count;
+            auto reader = set.create_single_key_sstable_reader(
+                    &*cf, s, permit, eh, pr, slice,
+                    tracing::trace_state_ptr(), ::streamed_mutation::forwarding::no,
+                    ::mutation_reader::forwarding::no);
+            auto close_reader = deferred_close(reader);
+            auto rows = 0;
+            while (auto mf = reader().get()) {
+                rows += mf->is_clustering_row();
+            }
+            BOOST_REQUIRE_EQUAL(rows, expected_rows);
+            return cf_stats.clustering_filter_fast_path_count != fast_path_count;
+        };
+
+        // The partition tombstone is of another partition, so the read may
+        // still open sstables in the middle of the partition.
+        BOOST_REQUIRE(!read_on_standard_path(2));
+
+        // A partition tombstone of the queried partition forces the standard path.
+        auto same_key_tombstone = make_row(0, 2);
+        same_key_tombstone.apply(make_partition_tombstone(0));
+        set.insert(make_sstable_containing(sst_gen, {std::move(same_key_tombstone)}).get());
+        BOOST_REQUIRE(read_on_standard_path(3));
+    });
+}
+
 void max_ongoing_compaction_fn(test_env& env) {
     BOOST_REQUIRE(this_smp_shard_count() == 1);
 
@@ -6268,6 +6351,55 @@ SEASTAR_FIXTURE_TEST_CASE(simple_backlog_controller_test_incremental_gcs, gcs_fi
     return run_controller_test(compaction::compaction_strategy_type::incremental, test_env_config{.storage = make_test_object_storage_options("GS")});
 }
 
+// The controller scales the backlog by the p99 of sstables touched per read
+// over the last controller interval, relative to the configured target.
+SEASTAR_THREAD_TEST_CASE(read_amplification_boost_test) {
+    utils::estimated_histogram h{35};
+    constexpr int64_t min_count = 100;
+    auto tick = [&, previous = h.get_buckets()] () mutable {
+        auto p99 = compaction_controller::interval_percentile(h, previous, 0.99, min_count);
+        previous = h.get_buckets();
+        return p99;
+    };
+
+    // Too few reads in the interval to tell anything.
+    for (int i = 0; i < min_count - 1; ++i) {
+        h.add(20);
+    }
+    BOOST_REQUIRE_EQUAL(tick(), 0);
+
+    // Reads from the previous interval don't count.
+    for (int i = 0; i < 990; ++i) {
+        h.add(2);
+    }
+    for (int i = 0; i < 10; ++i) {
+        h.add(100);
+    }
+    BOOST_REQUIRE_EQUAL(tick(), 2);
+
+    for (int i = 0; i < 1000; ++i) {
+        h.add(12);
+    }
+    auto p99 = tick();
+    BOOST_REQUIRE_EQUAL(p99, 12);
+
+    // No boost at or below the target, or without one.
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(2, 4, 0), 1.0f);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(4, 4, 0), 1.0f);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 0, 0), 1.0f);
+
+    // Proportional to the excess, up to the cap.
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 4, 0), 3.0f);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 2, 0), compaction_controller::max_read_amplification_boost);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(1000, 1, 0), compaction_controller::max_read_amplification_boost);
+
+    // Fades out as flush pressure approaches the dirty hard limit.
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 4, 0.5), 2.0f);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 4, 1), 1.0f);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 4, 2), 1.0f);
+    BOOST_REQUIRE_EQUAL(compaction_controller::read_amplification_boost(p99, 4, -1), 3.0f);
+}
+
 void test_compaction_strategy_cleanup_method_fn(test_env& env, size_t all_files = 64) {
 
     auto get_cleanup_jobs = [&env, all_files] (compaction::compaction_strategy_type compaction_strategy_type,
@@ -789,6 +789,108 @@ SEASTAR_TEST_CASE(test_has_partition_key) {
     });
 }
 
+SEASTAR_TEST_CASE(test_column_projection_keeps_unselected_cells) {
+    return test_env::do_with_async([] (test_env& env) {
+        for (const auto version : writable_sstable_versions) {
+            auto s = schema_builder(this_smp_shard_count(), "ks", "cf")
+                .with_column("p", utf8_type, column_kind::partition_key)
+                .with_column("c", int32_type, column_kind::clustering_key)
+                .with_column("v1", int32_type)
+                .with_column("v2", utf8_type)
+                .build();
+            const auto& v1 = *s->get_column_definition("v1");
+            const auto& v2 = *s->get_column_definition("v2");
+
+            auto dk = tests::generate_partition_key(s);
+            auto ck1 = clustering_key::from_exploded(*s, {int32_type->decompose(1)});
+            auto ck2 = clustering_key::from_exploded(*s, {int32_type->decompose(2)});
+
+            mutation m(s, dk);
+            m.set_clustered_cell(ck1, v1, atomic_cell::make_live(*int32_type, 1, int32_type->decompose(17), { }));
+            m.set_clustered_cell(ck1, v2, atomic_cell::make_live(*utf8_type, 1, utf8_type->decompose(sstring(1024, 'x')), { }));
+            // Only the unselected column keeps this row alive.
+            m.set_clustered_cell(ck2, v2, atomic_cell::make_live(*utf8_type, 2, utf8_type->decompose(sstring("y")), { }));
+
+            auto sst = make_sstable_containing(env.make_sstable(s, version), {m}).get();
+
+            auto slice = partition_slice_builder(*s).with_regular_column(to_bytes("v1")).build();
+            slice.set_allow_column_projection(true);
+            auto mut = with_closeable(sst->make_reader(s, env.make_reader_permit(), query::full_partition_range, slice), [] (auto& mr) {
+                return read_mutation_from_mutation_reader(mr);
+            }).get();
+            BOOST_REQUIRE(mut);
+
+            auto get_cell = [&] (const clustering_key& ck, const column_definition& def) {
+                auto* row = mut->partition().find_row(*s, ck);
+                BOOST_REQUIRE(row);
+                auto* cell = row->find_cell(def.id);
+                BOOST_REQUIRE(cell);
+                return cell->as_atomic_cell(def);
+            };
+
+            BOOST_REQUIRE_EQUAL(get_cell(ck1, v1).value().linearize(), int32_type->decompose(17));
+
+            for (auto [ck, ts] : {std::pair(ck1, api::timestamp_type(1)), std::pair(ck2, api::timestamp_type(2))}) {
+                auto projected = get_cell(ck, v2);
+                BOOST_REQUIRE(projected.is_live());
+                BOOST_REQUIRE_EQUAL(projected.timestamp(), ts);
+                BOOST_REQUIRE(projected.value().empty());
+            }
+        }
+    });
+}
+
+SEASTAR_TEST_CASE(test_clustering_filter_strips_rejected_rows) {
+    return test_env::do_with_async([] (test_env& env) {
+        for (const auto version : writable_sstable_versions) {
+            auto s = schema_builder(this_smp_shard_count(), "ks", "cf")
+                .with_column("p", utf8_type, column_kind::partition_key)
+                .with_column("c1", int32_type, column_kind::clustering_key)
+                .with_column("c2", int32_type, column_kind::clustering_key)
+                .with_column("v", int32_type)
+                .build();
+            const auto& v = *s->get_column_definition("v");
+
+            auto dk = tests::generate_partition_key(s);
+            auto make_ck = [&] (int c1, int c2) {
+                return clustering_key::from_exploded(*s, {int32_type->decompose(c1), int32_type->decompose(c2)});
+            };
+
+            mutation m(s, dk);
+            for (int c1 = 0; c1 < 3; ++c1) {
+                for (int c2 = 0; c2 < 10; ++c2) {
+                    m.set_clustered_cell(make_ck(c1, c2), v, atomic_cell::make_live(*int32_type, 1, int32_type->decompose(c1 * 10 + c2), { }));
+                }
+            }
+
+            auto sst = make_sstable_containing(env.make_sstable(s, version), {m}).get();
+
+            // c2 IN (3, 8) AND c2 >= 8
+            using op = query::clustering_column_restriction::op;
+            auto slice = s->full_slice();
+            slice.set_clustering_filter({
+                {1, op::eq, {int32_type->decompose(3), int32_type->decompose(8)}},
+                {1, op::gte, {int32_type->decompose(8)}},
+            });
+            auto mut = with_closeable(sst->make_reader(s, env.make_reader_permit(), query::full_partition_range, slice), [] (auto& mr) {
+                return read_mutation_from_mutation_reader(mr);
+            }).get();
+            BOOST_REQUIRE(mut);
+
+            // Rejected rows are still emitted, but with their key only.
+            auto rows = mut->partition().clustered_rows().calculate_size();
+            BOOST_REQUIRE_EQUAL(rows, 30u);
+            for (int c1 = 0; c1 < 3; ++c1) {
+                for (int c2 = 0; c2 < 10; ++c2) {
+                    auto row = mut->partition().find_row(*s, make_ck(c1, c2));
+                    BOOST_REQUIRE(row);
+                    BOOST_REQUIRE_EQUAL(row->size(), c2 == 8 ? 1u : 0u);
+                }
+            }
+        }
+    });
+}
+
 static std::unique_ptr<abstract_index_reader> get_index_reader(shared_sstable sst, reader_permit permit) {
     return sst->make_index_reader(std::move(permit));
 }
@@ -19,9 +19,12 @@
 #include "transport/messages/result_message.hh"
 #include "types/types.hh"
 #include "service/storage_proxy.hh"
+#include "service/speculative_retry_budget.hh"
 #include "query_ranges_to_vnodes.hh"
 #include "schema/schema_builder.hh"
 #include "utils/error_injection.hh"
+#include "db/config.hh"
+#include "replica/database.hh"
 
 BOOST_AUTO_TEST_SUITE(storage_proxy_test)
 
@@ -198,4 +201,90 @@ SEASTAR_TEST_CASE(test_drop_table_during_range_scan) {
 #endif
 }
 
+SEASTAR_THREAD_TEST_CASE(test_speculative_retry_budget) {
+    service::speculative_retry_budget budget;
+
+    // Each read deposits a quarter of a retry.
+    BOOST_REQUIRE(!budget.consume());
+    for (int i = 0; i < 3; ++i) {
+        budget.deposit(0.25);
+    }
+    BOOST_REQUIRE(!budget.consume());
+    BOOST_REQUIRE_EQUAL(budget.available(), 0.75);
+
+    // Retries after a replica disconnected are exempt.
+    BOOST_REQUIRE(budget.consume(true));
+    BOOST_REQUIRE_EQUAL(budget.available(), 0.75);
+
+    budget.deposit(0.25);
+    BOOST_REQUIRE(budget.consume());
+    BOOST_REQUIRE_EQUAL(budget.available(), 0);
+    BOOST_REQUIRE(!budget.consume());
+
+    // Only a limited burst of retries is saved up.
+    for (int i = 0; i < 100; ++i) {
+        budget.deposit(1);
+    }
+    BOOST_REQUIRE_EQUAL(budget.available(), service::speculative_retry_budget::max_retries);
+    for (int i = 0; i < service::speculative_retry_budget::max_retries; ++i) {
+        BOOST_REQUIRE(budget.consume());
+    }
+    BOOST_REQUIRE(!budget.consume());
+}
+
+SEASTAR_TEST_CASE(test_predict_replica_read_latency) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        using namespace std::chrono_literals;
+        e.execute_cql("CREATE TABLE ks.t (pk int PRIMARY KEY, v int)").get();
+        auto& t = e.local_db().find_column_family("ks", "t");
+        auto replica = locator::host_id::create_random_id();
+
+        BOOST_REQUIRE(!t.predict_replica_read_latency(replica));
+
+        // The first sample sets the mean, and half of it as the deviation.
+        t.add_replica_read_latency(replica, 1000us);
+        BOOST_REQUIRE(t.predict_replica_read_latency(replica) == 3000us);
+
+        // The deviation decays by a quarter towards the distance from the
+        // mean, and the mean by an eighth towards the sample.
+        t.add_replica_read_latency(replica, 1000us);
+        BOOST_REQUIRE(t.predict_replica_read_latency(replica) == 1000us + 4 * 375us);
+        t.add_replica_read_latency(replica, 2000us);
+        BOOST_REQUIRE(t.predict_replica_read_latency(replica) == 1125us + 4 * 531us);
+
+        // Other replicas are tracked separately.
+        BOOST_REQUIRE(!t.predict_replica_read_latency(locator::host_id::create_random_id()));
+
+        // Estimates are dropped when the replica disconnects.
+        t.drop_replica_read_latency(replica);
+        BOOST_REQUIRE(!t.predict_replica_read_latency(replica));
+    });
+}
+
+SEASTAR_TEST_CASE(test_adaptive_speculative_retry_tracks_replica_latency) {
+    for (bool adaptive : {false, true}) {
+        auto cfg = make_shared<db::config>();
+        cfg->adaptive_speculative_retry.set(adaptive);
+        co_await do_with_cql_env_thread([adaptive] (cql_test_env& e) {
+            e.execute_cql("CREATE TABLE ks.t (pk int PRIMARY KEY, v int) WITH speculative_retry = '99.0PERCENTILE'").get();
+            for (int pk = 0; pk < 10; ++pk) {
+                e.execute_cql(format("INSERT INTO ks.t (pk, v) VALUES ({}, {})", pk, pk)).get();
+            }
+            for (int pk = 0; pk < 10; ++pk) {
+                auto msg = e.execute_cql(format("SELECT v FROM ks.t WHERE pk = {}", pk)).get();
+                assert_that(msg).is_rows().with_rows({{int32_type->decompose(pk)}});
+            }
+            auto tracked = e.db().map_reduce0([] (replica::database& db) {
+                auto& t = db.find_column_family("ks", "t");
+                return t.predict_replica_read_latency(db.get_token_metadata().get_my_id()) ? 1 : 0;
+            }, 0, std::plus<int>()).get();
+            if (adaptive) {
+                BOOST_REQUIRE_GT(tracked, 0);
+            } else {
+                BOOST_REQUIRE_EQUAL(tracked, 0);
+            }
+        }, cfg);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -229,3 +229,17 @@ def test_one_row(scylla_only, cql):
     assert cql.execute("SELECT count(*) FROM system.one_row").one()[0] == 1
     with pytest.raises(WriteFailure, match="virtual table"):
         cql.execute("INSERT INTO system.one_row (\"system$dummy\") VALUES ('Y')")
+
+# system.hot_partitions is fed by a sample of the replica reads and writes, so
+# only check that a partition hammered with writes shows up as the hottest one
+# of its table, after the row with rank 0 summarizing the whole table.
+def test_hot_partitions(scylla_only, cql, test_keyspace):
+    with util.new_test_table(cql, test_keyspace, "p int PRIMARY KEY, v int") as table:
+        stmt = cql.prepare(f"INSERT INTO {table} (p, v) VALUES (?, ?)")
+        for i in range(1000):
+            cql.execute(stmt, [1, i])
+        ks, cf = table.split('.')
+        rows = list(cql.execute(f"SELECT rank, partition_key, count, bytes FROM system.hot_partitions WHERE keyspace_name = '{ks}' AND table_name = '{cf}' AND operation = 'write'"))
+        assert len(rows) == 2
+        assert rows[0].rank == 0 and rows[0].count > 0 and rows[0].bytes > 0
+        assert rows[1].rank == 1 and rows[1].partition_key == '1' and rows[1].count > 0
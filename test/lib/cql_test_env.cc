@@ -424,6 +424,10 @@ class single_node_cql_env : public cql_test_env {
         return _proxy;
     }
 
+    virtual sharded<service::mapreduce_service>& get_mapreduce_service() override {
+        return _mapreduce_service;
+    }
+
     virtual sharded<service::paxos::paxos_store>& get_paxos_store() override {
         return _paxos_store;
     }
@@ -61,6 +61,7 @@ class disk_space_monitor;
 namespace service {
 
 class client_state;
+class mapreduce_service;
 class migration_manager;
 class raft_group0_client;
 class raft_group_registry;
@@ -203,6 +204,8 @@ class cql_test_env {
 
     virtual sharded<service::storage_proxy>& get_storage_proxy() = 0;
 
+    virtual sharded<service::mapreduce_service>& get_mapreduce_service() = 0;
+
     virtual sharded<service::paxos::paxos_store>& get_paxos_store() = 0;
 
     virtual sharded<gms::feature_service>& get_feature_service() = 0;
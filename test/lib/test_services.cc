@@ -138,6 +138,9 @@ class table_for_tests::compaction_group_view : public compaction::compaction_gro
         return table().get_token_range_after_split(t);
     }
     int64_t get_sstables_repaired_at() const noexcept override { return 0; }
+    const utils::estimated_histogram& sstables_per_read_histogram() const noexcept override {
+        return table().get_stats().estimated_sstable_per_read;
+    }
 };
 
 table_for_tests::data::data()
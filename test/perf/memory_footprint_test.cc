@@ -142,12 +142,14 @@ struct mutation_settings {
     size_t partition_key_size;
     size_t clustering_key_size;
     size_t data_size;
+    // Time-series layout: clustering keys are increasing bigints, rows are appended.
+    bool time_series;
 };
 
 static schema_ptr make_schema(const mutation_settings& settings) {
     auto builder = schema_builder(this_smp_shard_count(), "ks", "cf")
         .with_column("pk", bytes_type, column_kind::partition_key)
-        .with_column("ck", bytes_type, column_kind::clustering_key);
+        .with_column("ck", settings.time_series ? long_type : bytes_type, column_kind::clustering_key);
 
     for (size_t i = 0; i < settings.column_count; ++i) {
         builder.with_column(to_bytes(random_name(settings.column_name_size)), bytes_type);
@@ -160,7 +162,9 @@ static mutation make_mutation(schema_ptr s, mutation_settings settings) {
     mutation m(s, partition_key::from_single_value(*s, bytes_type->decompose(data_value(random_bytes(settings.partition_key_size)))));
 
     for (size_t i = 0; i < settings.row_count; ++i) {
-        auto ck = clustering_key::from_single_value(*s, bytes_type->decompose(data_value(random_bytes(settings.clustering_key_size))));
+        auto ck = settings.time_series
+                ? clustering_key::from_single_value(*s, long_type->decompose(data_value(int64_t(i))))
+                : clustering_key::from_single_value(*s, bytes_type->decompose(data_value(random_bytes(settings.clustering_key_size))));
         for (auto&& col : s->regular_columns()) {
             m.set_clustered_cell(ck, col,
                 atomic_cell::make_live(*bytes_type, 1,
@@ -229,7 +233,8 @@ int main(int argc, char** argv) {
         ("partition-count", bpo::value<size_t>()->default_value(1), "partition count")
         ("partition-key-size", bpo::value<size_t>()->default_value(10), "partition key size")
         ("clustering-key-size", bpo::value<size_t>()->default_value(10), "clustering key size")
-        ("data-size", bpo::value<size_t>()->default_value(32), "cell data size");
+        ("data-size", bpo::value<size_t>()->default_value(32), "cell data size")
+        ("time-series", "use increasing bigint clustering keys, like a time-series table (ignores --clustering-key-size)");
 
     return app.run(argc, argv, [&] {
         if (this_smp_shard_count() != 1) {
@@ -249,6 +254,7 @@ int main(int argc, char** argv) {
             settings.partition_key_size = app.configuration()["partition-key-size"].as<size_t>();
             settings.clustering_key_size = app.configuration()["clustering-key-size"].as<size_t>();
             settings.data_size = app.configuration()["data-size"].as<size_t>();
+            settings.time_series = app.configuration().contains("time-series");
 
             auto& tracker = env.local_db().find_column_family("system", "local").get_row_cache().get_cache_tracker();
             auto sizes = calculate_sizes(tracker, settings);
@@ -264,6 +270,13 @@ int main(int argc, char** argv) {
             std::cout << " - canonical:    " << sizes.canonical << "\n";
             std::cout << " - query result: " << sizes.query_result << "\n";
 
+            // Either count may be 0, e.g. to measure an empty partition.
+            if (auto rows = settings.row_count * settings.partition_count) {
+                std::cout << "row footprint (including amortized partition overhead):" << "\n";
+                std::cout << " - in cache:     " << sizes.cache / rows << "\n";
+                std::cout << " - in memtable:  " << sizes.memtable / rows << "\n";
+            }
+
             std::cout << "\n";
             size_calculator::print_cache_entry_size();
 
@@ -18,6 +18,7 @@
 #include "partition_slice_builder.hh"
 #include "utils/int_range.hh"
 #include "utils/div_ceil.hh"
+#include "utils/logalloc.hh"
 #include <seastar/core/reactor.hh>
 #include <seastar/util/defer.hh>
 
@@ -48,6 +49,8 @@ int main(int argc, char** argv) {
         ("trace", "Enables trace-level logging for the test actions")
         ("no-reads", "Disable reads during the test")
         ("seconds", bpo::value<unsigned>()->default_value(60), "Duration [s] after which the test terminates with a success")
+        ("defragment-on-idle", "Compact LSA memory as much as possible when the cpu is idle")
+        ("idle-free-segments", bpo::value<size_t>()->default_value(0), "Number of free LSA segments to prepare when the cpu is idle and memory is short")
         ;
 
     return app.run(argc, argv, [&app] {
@@ -67,6 +70,24 @@ int main(int argc, char** argv) {
         return do_with_cql_env_thread([&app] (cql_test_env& env) {
             auto reads_enabled = !app.configuration().contains("no-reads");
             auto seconds = app.configuration()["seconds"].as<unsigned>();
+            auto defragment_on_idle = app.configuration().contains("defragment-on-idle");
+            auto idle_free_segments = app.configuration()["idle-free-segments"].as<size_t>();
+
+            bool lsa_configured = defragment_on_idle || idle_free_segments;
+            if (lsa_configured) {
+                logalloc::tracker::config st_cfg;
+                st_cfg.defragment_on_idle = defragment_on_idle;
+                st_cfg.idle_free_segments = idle_free_segments;
+                st_cfg.abort_on_lsa_bad_alloc = false;
+                st_cfg.lsa_reclamation_step = 1;
+                st_cfg.background_reclaim_sched_group = default_scheduling_group();
+                logalloc::shard_tracker().configure(st_cfg);
+            }
+            auto stop_lsa_background_reclaim = defer([lsa_configured] () noexcept {
+                if (lsa_configured) {
+                    logalloc::shard_tracker().stop().get();
+                }
+            });
 
             auto stop_test = defer([] noexcept {
                 cancelled = true;
@@ -98,14 +119,18 @@ int main(int argc, char** argv) {
             monotonic_counter<uint64_t> pmerges_ctr([&] { return tracker.get_stats().partition_merges; });
             monotonic_counter<uint64_t> eviction_ctr([&] { return tracker.get_stats().row_evictions; });
             monotonic_counter<uint64_t> miss_ctr([&] { return tracker.get_stats().reads_with_misses; });
+            monotonic_counter<uint64_t> fg_reclaim_ctr([&] { return logalloc::shard_tracker().statistics().foreground_reclaims; });
+            monotonic_counter<uint64_t> idle_compact_ctr([&] { return logalloc::shard_tracker().statistics().idle_segments_compacted; });
             stats_printer.set_callback([&] {
                 auto MB = 1024 * 1024;
-                std::cout << format("rd/s: {:d}, wr/s: {:d}, ev/s: {:d}, pmerge/s: {:d}, miss/s: {:d}, cache: {:d}/{:d} [MB], LSA: {:d}/{:d} [MB], std free: {:d} [MB]",
+                std::cout << format("rd/s: {:d}, wr/s: {:d}, ev/s: {:d}, pmerge/s: {:d}, miss/s: {:d}, fg-reclaim/s: {:d}, idle-compact/s: {:d}, cache: {:d}/{:d} [MB], LSA: {:d}/{:d} [MB], std free: {:d} [MB]",
                     reads_ctr.change(),
                     mutations_ctr.change(),
                     eviction_ctr.change(),
                     pmerges_ctr.change(),
                     miss_ctr.change(),
+                    fg_reclaim_ctr.change(),
+                    idle_compact_ctr.change(),
                     tracker.region().occupancy().used_space() / MB,
                     tracker.region().occupancy().total_space() / MB,
                     logalloc::shard_tracker().region_occupancy().used_space() / MB,
@@ -89,9 +89,13 @@ void scan_collection(Col& c, int batch) {
 
 #include "utils/bptree.hh"
 
+/*
+ * On node size 32 (this test) linear search works better.
+ * bptree16 uses the node size of the memtable and row cache partition trees.
+ */
+template <size_t NodeSize>
 class bptree_tester : public collection_tester {
-    /* On node size 32 (this test) linear search works better */
-    using test_tree = bplus::tree<per_key_t, unsigned long, perf_key_compare, 4, bplus::key_search::linear>;
+    using test_tree = bplus::tree<per_key_t, unsigned long, perf_key_compare, NodeSize, bplus::key_search::linear>;
 
     test_tree _t;
 public:
@@ -324,7 +328,9 @@ int main(int argc, char **argv) {
             std::unique_ptr<collection_tester> c;
 
             if (col == "bptree") {
-                c = std::make_unique<bptree_tester>();
+                c = std::make_unique<bptree_tester<4>>();
+            } else if (col == "bptree16") {
+                c = std::make_unique<bptree_tester<16>>();
             } else if (col == "btree") {
                 c = std::make_unique<btree_tester>();
             } else if (col == "set") {
@@ -68,6 +68,9 @@ struct raw_cql_test_config {
     bool use_prepared = true;
     bool create_non_superuser = false;
     unsigned tables = 1;
+    // Rows of each partition, in tables with a three-column clustering key.
+    // 0 means tables without a clustering key.
+    unsigned clustering_rows = 0;
     std::string json_result_file;
 };
 
@@ -77,8 +80,8 @@ template <>
 struct fmt::formatter<perf::raw_cql_test_config> {
     constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
     auto format(const perf::raw_cql_test_config& c, format_context& ctx) const {
-        return fmt::format_to(ctx.out(), "{{workload={}, partitions={}, concurrency={}, connections={}, tables={}, duration={}, ops_per_shard={}{}{}{}{}}}",
-            c.workload, c.partitions, c.concurrency_per_connection, c.connections_per_shard, c.tables, c.duration_in_seconds, c.operations_per_shard,
+        return fmt::format_to(ctx.out(), "{{workload={}, partitions={}, clustering_rows={}, concurrency={}, connections={}, tables={}, duration={}, ops_per_shard={}{}{}{}{}}}",
+            c.workload, c.partitions, c.clustering_rows, c.concurrency_per_connection, c.connections_per_shard, c.tables, c.duration_in_seconds, c.operations_per_shard,
             (c.username.empty() ? "" : ", auth"),
             (c.connection_per_request ? ", connection_per_request" : ""),
             (c.use_prepared ? ", use_prepared" : ""),
@@ -448,12 +451,15 @@ class raw_cql_connection {
         }
     }
 
-    future<> prepare_statements(unsigned tables) {
+    future<> prepare_statements(unsigned tables, bool clustering_key) {
         if (!_use_prepared) {
             co_return;
         }
         for (unsigned i = 0; i < tables; ++i) {
-            _write_stmt_ids.push_back(co_await prepare_query(fmt::format("INSERT INTO ks.cf{}(pk,c0,c1,c2,c3,c4) VALUES (?,0x01,0x02,0x03,0x04,0x05)", i)));
+            // Tables with a clustering key are only written by write_clustering_rows().
+            if (!clustering_key) {
+                _write_stmt_ids.push_back(co_await prepare_query(fmt::format("INSERT INTO ks.cf{}(pk,c0,c1,c2,c3,c4) VALUES (?,0x01,0x02,0x03,0x04,0x05)", i)));
+            }
             _read_stmt_ids.push_back(co_await prepare_query(fmt::format("SELECT * FROM ks.cf{} WHERE pk=?", i)));
         }
     }
@@ -468,6 +474,16 @@ class raw_cql_connection {
         }
     }
 
+    // Populates a partition of a table with a clustering key. Not timed, so
+    // it doesn't bother with prepared statements.
+    future<> write_clustering_rows(unsigned table_idx, uint64_t seq, unsigned rows) {
+        auto key_hex = to_hex(make_key(seq));
+        for (unsigned row = 0; row < rows; ++row) {
+            co_await query_simple(fmt::format("INSERT INTO ks.cf{}(pk,ck0,ck1,ck2,c0,c1,c2,c3,c4) VALUES (0x{},{},0x0102030405060708,0x{:08x},0x01,0x02,0x03,0x04,0x05)",
+                    table_idx, key_hex, row, row));
+        }
+    }
+
     future<> read_one(unsigned table_idx, uint64_t seq) {
         auto key = make_key(seq);
         if (_use_prepared) {
@@ -479,13 +495,18 @@ class raw_cql_connection {
     }
 };
 
-static future<> ensure_schema(raw_cql_connection& conn, unsigned tables) {
+static future<> ensure_schema(raw_cql_connection& conn, unsigned tables, bool clustering_key) {
     co_await conn.query_simple("CREATE KEYSPACE IF NOT EXISTS ks WITH replication={'class': 'NetworkTopologyStrategy'}");
     for (unsigned i = 0; i < tables; ++i) {
         if (tables > 100 && (i+1) % 100 == 0) {
              std::cout << "Creating schema in progress [" << i+1 << "/" << tables << "]" << std::endl;
         }
-        co_await conn.query_simple(fmt::format("CREATE TABLE IF NOT EXISTS ks.cf{} (pk blob primary key, c0 blob, c1 blob, c2 blob, c3 blob, c4 blob)", i));
+        if (clustering_key) {
+            co_await conn.query_simple(fmt::format("CREATE TABLE IF NOT EXISTS ks.cf{} (pk blob, ck0 int, ck1 blob, ck2 blob, c0 blob, c1 blob, c2 blob, c3 blob, c4 blob, "
+                    "PRIMARY KEY (pk, ck0, ck1, ck2))", i));
+        } else {
+            co_await conn.query_simple(fmt::format("CREATE TABLE IF NOT EXISTS ks.cf{} (pk blob primary key, c0 blob, c1 blob, c2 blob, c3 blob, c4 blob)", i));
+        }
     }
 }
 
@@ -534,7 +555,7 @@ static future<> run_one_with_new_connection(const raw_cql_test_config& cfg) {
     try {
         co_await c->startup();
         if (cfg.workload != "connect") {
-            co_await c->prepare_statements(cfg.tables);
+            co_await c->prepare_statements(cfg.tables, cfg.clustering_rows > 0);
             co_await do_request(*c, cfg);
         }
     } catch (...) {
@@ -618,7 +639,7 @@ static future<> prepare_thread_connections(const raw_cql_test_config& cfg) {
         std::exception_ptr ep;
         try {
             co_await c->startup();
-            co_await c->prepare_statements(cfg.tables);
+            co_await c->prepare_statements(cfg.tables, cfg.clustering_rows > 0);
         } catch (...) {
             ep = std::current_exception();
         }
@@ -653,7 +674,7 @@ static void prepopulate(const raw_cql_test_config& cfg) {
             raw_cql_connection superuser_conn(std::move(superuser_cs), sstring(cfg.username), sstring(cfg.password), false);
             try {
                 superuser_conn.startup().get();
-                ensure_schema(superuser_conn, cfg.tables).get();
+                ensure_schema(superuser_conn, cfg.tables, cfg.clustering_rows > 0).get();
                 create_role_with_permissions(superuser_conn, non_superuser_name, non_superuser_password, cfg.tables).get();
             } catch (...) {
                 superuser_conn.stop().get();
@@ -682,12 +703,16 @@ static void prepopulate(const raw_cql_test_config& cfg) {
         try {
             conn->startup().get();
             if (!cfg.create_non_superuser) {
-                ensure_schema(*conn, cfg.tables).get();
+                ensure_schema(*conn, cfg.tables, cfg.clustering_rows > 0).get();
             }
-            conn->prepare_statements(cfg.tables).get();
+            conn->prepare_statements(cfg.tables, cfg.clustering_rows > 0).get();
             for (unsigned t = 0; t < cfg.tables; ++t) {
                 for (uint64_t seq = 0; seq < cfg.partitions; ++seq) {
-                    conn->write_one(t, seq).get();
+                    if (cfg.clustering_rows > 0) {
+                        conn->write_clustering_rows(t, seq, cfg.clustering_rows).get();
+                    } else {
+                        conn->write_one(t, seq).get();
+                    }
                 }
             }
         } catch (...) {
@@ -776,6 +801,7 @@ static void workload_main(const raw_cql_test_config& cfg, sharded<abort_source>*
         Json::Value params;
         params["workload"] = cfg.workload;
         params["partitions"] = cfg.partitions;
+        params["clustering_rows"] = cfg.clustering_rows;
         params["tables"] = cfg.tables;
         params["duration"] = cfg.duration_in_seconds;
         params["operations_per_shard"] = cfg.operations_per_shard;
@@ -807,6 +833,7 @@ std::function<int(int, char**)> perf_cql_raw(std::function<int(int, char**)> scy
         opts_desc.add_options()
             ("workload", bpo::value<std::string>()->default_value("read"), "workload type: read|write|connect")
             ("partitions", bpo::value<unsigned>()->default_value(10000), "number of partitions")
+            ("clustering-rows", bpo::value<unsigned>()->default_value(0), "rows of each partition, in tables with a three-column clustering key (read workload only, 0 for tables without a clustering key)")
             ("tables", bpo::value<unsigned>()->default_value(1), "number of tables")
             ("duration", bpo::value<unsigned>()->default_value(5), "test duration seconds")
             ("operations-per-shard", bpo::value<unsigned>()->default_value(0), "fixed op count per shard")
@@ -825,6 +852,7 @@ std::function<int(int, char**)> perf_cql_raw(std::function<int(int, char**)> scy
 
         c.workload = vm["workload"].as<std::string>();
         c.partitions = vm["partitions"].as<unsigned>();
+        c.clustering_rows = vm["clustering-rows"].as<unsigned>();
         c.tables = vm["tables"].as<unsigned>();
         c.duration_in_seconds = vm["duration"].as<unsigned>();
         c.operations_per_shard = vm["operations-per-shard"].as<unsigned>();
@@ -850,6 +878,10 @@ std::function<int(int, char**)> perf_cql_raw(std::function<int(int, char**)> scy
         if (c.workload != "read" && c.workload != "write" && c.workload != "connect") {
             std::cerr << "Unknown workload: " << c.workload << "\n"; return 1;
         }
+        if (c.clustering_rows > 0 && c.workload != "read") {
+            std::cerr << "--clustering-rows works only with the read workload" << std::endl;
+            return 1;
+        }
 
         // Remove test options to not disturb scylla main app
         for (auto& opt : opts_desc.options()) {
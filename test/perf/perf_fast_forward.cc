@@ -919,6 +919,21 @@ static test_result slice_rows_by_ck(replica::column_family& cf, clustered_ds& ds
     return test_reading_all(rd);
 }
 
+// Reads rows in [offset, offset + n_read) in reverse clustering order.
+static test_result slice_rows_by_ck_reversed(replica::column_family& cf, clustered_ds& ds, int offset = 0, int n_read = 1) {
+    tests::reader_concurrency_semaphore_wrapper semaphore;
+    auto slice = partition_slice_builder(*cf.schema())
+        .with_range(query::clustering_range::make(
+            ds.make_ck(*cf.schema(), offset),
+            ds.make_ck(*cf.schema(), offset + n_read - 1)))
+        .build();
+    auto pr = dht::partition_range::make_singular(dht::decorate_key(*cf.schema(), ds.make_pk(*cf.schema())));
+    auto rd = cf.make_mutation_reader(cf.schema()->make_reversed(), semaphore.make_permit(), pr, query::reverse_slice(*cf.schema(), std::move(slice)));
+    auto close_rd = deferred_close(rd);
+
+    return test_reading_all(rd);
+}
+
 static test_result select_spread_rows(replica::column_family& cf, clustered_ds& ds, int stride = 0, int n_read = 1, int offset = 0) {
     tests::reader_concurrency_semaphore_wrapper semaphore;
     auto sb = partition_slice_builder(*cf.schema());
@@ -1598,6 +1613,37 @@ void test_large_partition_slicing_clustering_keys(app_template &app, replica::co
     test(n_rows / 2, 4096);
 }
 
+void test_large_partition_slicing_clustering_keys_reversed(app_template &app, replica::column_family& cf, clustered_ds& ds) {
+    auto n_rows = ds.n_rows(cfg);
+
+    output_mgr->set_test_param_names({{"offset", "{:<7}"}, {"read", "{:<7}"}}, test_result::stats_names());
+    auto test = [&] (int offset, int read) {
+      run_test_case(app, [&] {
+        auto r = slice_rows_by_ck_reversed(cf, ds, offset, read);
+        r.set_params(to_sstrings(offset, read));
+        check_fragment_count(r, std::min(n_rows - offset, read));
+        return r;
+      });
+    };
+
+    test(0, 1);
+    test(0, 32);
+    test(0, 256);
+    test(0, 4096);
+
+    test(n_rows / 2, 1);
+    test(n_rows / 2, 32);
+    test(n_rows / 2, 256);
+    test(n_rows / 2, 4096);
+
+    // Ranges reaching the end of the partition, which has no successor to find the last row from.
+    test(n_rows - 1, 1);
+    test(std::max(0, n_rows - 32), 32);
+    test(std::max(0, n_rows - 4096), 4096);
+
+    test(0, n_rows);
+}
+
 void test_large_partition_slicing_single_partition_reader(app_template &app, replica::column_family& cf, clustered_ds& ds) {
     auto n_rows = ds.n_rows(cfg);
 
@@ -1895,6 +1941,13 @@ static std::initializer_list<test_group> test_groups = {
         test_group::type::large_partition,
         make_test_fn(test_large_partition_slicing_clustering_keys),
     },
+    {
+        "large-partition-slicing-clustering-keys-reversed",
+        "Testing reversed slicing of large partition using clustering keys",
+        test_group::requires_cache::no,
+        test_group::type::large_partition,
+        make_test_fn(test_large_partition_slicing_clustering_keys_reversed),
+    },
     {
         "large-partition-slicing-single-key-reader",
         "Testing slicing of large partition, single-partition reader",
@@ -12,6 +12,7 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <json/json.h>
 #include <fmt/ranges.h>
+#include <ranges>
 
 #include "test/lib/cql_test_env.hh"
 #include "test/perf/perf.hh"
@@ -34,6 +35,7 @@
 #include "keys/keys.hh"
 #include "dht/i_partitioner.hh"
 #include "replica/database.hh"
+#include <seastar/core/loop.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/core/sharded.hh>
 
@@ -65,7 +67,7 @@ static sstring make_collection_literal(unsigned n) {
     return result;
 }
 
-static void execute_update_for_key(cql_test_env& env, const bytes& key, unsigned collection) {
+static void execute_update_for_key(cql_test_env& env, const bytes& key, unsigned collection, bool clustering_key) {
     sstring col_suffix;
     if (collection > 0) {
         col_suffix = fmt::format(", \"CC\" = {}", make_collection_literal(collection));
@@ -79,7 +81,7 @@ static void execute_update_for_key(cql_test_env& env, const bytes& key, unsigned
         "\"C2\" = 0x583449ce81bfebc2e1a695eb59aad5fcc74d6d7311fc6197b10693e1a161ca2e1c64,"
         "\"C3\" = 0x62bcb1dbc0ff953abc703bcb63ea954f437064c0c45366799658bd6b91d0f92908d7,"
         "\"C4\" = 0x222fcbe31ffa1e689540e1499b87fa3f9c781065fccd10e4772b4c7039c2efd0fb27{} "
-        "WHERE \"KEY\"= 0x{};", col_suffix, to_hex(key)), std::move(qo)).get();
+        "WHERE \"KEY\"= 0x{}{};", col_suffix, to_hex(key), clustering_key ? " AND \"CK\" = 0" : ""), std::move(qo)).get();
 };
 
 static void execute_counter_update_for_key(cql_test_env& env, const bytes& key) {
@@ -93,7 +95,7 @@ static void execute_counter_update_for_key(cql_test_env& env, const bytes& key)
 };
 
 struct test_config {
-    enum class run_mode { read, write, del };
+    enum class run_mode { read, write, del, aggregate };
     run_mode mode;
     unsigned partitions;
     unsigned concurrency;
@@ -110,6 +112,15 @@ struct test_config {
     unsigned collection = 0;
     db::consistency_level consistency_level;
     bool shard_aware;
+    bool coordinator_read_cache = false;
+    // Number of partitions written by each UNLOGGED BATCH in write mode,
+    // 0 means single-partition UPDATEs.
+    unsigned batch_size = 0;
+    // Number of rows of each partition in aggregate mode.
+    unsigned rows_per_partition = 0;
+    // Read mode reads a row by its full primary key, of a table with a
+    // clustering key, instead of a partition.
+    bool query_clustering_key = false;
 };
 
 // Partition sequence numbers grouped by the shard that services reads for them,
@@ -124,6 +135,7 @@ std::ostream& operator<<(std::ostream& os, const test_config::run_mode& m) {
         case test_config::run_mode::write: return os << "write";
         case test_config::run_mode::read: return os << "read";
         case test_config::run_mode::del: return os << "delete";
+        case test_config::run_mode::aggregate: return os << "aggregate";
     }
     abort();
 }
@@ -136,6 +148,10 @@ std::ostream& operator<<(std::ostream& os, const test_config& cfg) {
            << ", counters=" << (cfg.counters ? "yes" : "no")
            << ", collection=" << cfg.collection
            << ", shard_aware=" << (cfg.shard_aware ? "yes" : "no")
+           << ", coordinator_read_cache=" << (cfg.coordinator_read_cache ? "yes" : "no")
+           << ", batch_size=" << cfg.batch_size
+           << ", rows_per_partition=" << cfg.rows_per_partition
+           << ", query_clustering_key=" << (cfg.query_clustering_key ? "yes" : "no")
            << "}";
 }
 
@@ -146,7 +162,7 @@ static void create_partitions(cql_test_env& env, test_config& cfg) {
         if (cfg.counters) {
             execute_counter_update_for_key(env, make_key(sequence));
         } else {
-            execute_update_for_key(env, make_key(sequence), cfg.collection);
+            execute_update_for_key(env, make_key(sequence), cfg.collection, cfg.query_clustering_key);
         }
         if (sequence + 1 >= next_flush) {
             env.db().invoke_on_all(&replica::database::flush_all_memtables).get();
@@ -199,6 +215,36 @@ static std::optional<bytes> next_key(test_config& cfg, const std::vector<uint64_
     return make_key(tests::random::get_int<uint64_t>(cfg.partitions - 1));
 }
 
+// Prints, for each shard, how many reads of hot partitions it served from its
+// coordinator read cache, how stale they were on average, and how many reads
+// of the table its replica executed, which shows how the load of the hot
+// partitions is spread across shards.
+static void print_coordinator_read_cache_stats(cql_test_env& env) {
+    struct shard_stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t hit_age_ms = 0;
+    };
+    auto coordinator = env.get_storage_proxy().map([] (service::storage_proxy& sp) {
+        return map_reduce_scheduling_group_specific<service::storage_proxy_stats::stats>([] (const service::storage_proxy_stats::stats& s) {
+            return shard_stats{s.coordinator_read_cache_hits, s.coordinator_read_cache_misses, s.coordinator_read_cache_hit_age_ms};
+        }, [] (shard_stats a, const shard_stats& b) {
+            a.hits += b.hits;
+            a.misses += b.misses;
+            a.hit_age_ms += b.hit_age_ms;
+            return a;
+        }, shard_stats{}, sp.get_stats_key());
+    }).get();
+    auto replica_reads = env.db().map([] (replica::database& db) {
+        return db.find_column_family("ks", "cf").get_stats().reads.hist.count;
+    }).get();
+    for (unsigned shard = 0; shard < coordinator.size(); ++shard) {
+        const auto& s = coordinator[shard];
+        fmt::print("shard {}: read cache hits: {}, misses: {}, average staleness: {:.1f} ms, replica reads: {}\n",
+                shard, s.hits, s.misses, s.hits ? double(s.hit_age_ms) / s.hits : 0.0, replica_reads[shard]);
+    }
+}
+
 static std::vector<perf_result> test_read(cql_test_env& env, test_config& cfg, sharded<std::vector<uint64_t>>& shard_seqs) {
     create_partitions(env, cfg);
     sstring query = "select \"C0\", \"C1\", \"C2\", \"C3\", \"C4\"";
@@ -206,6 +252,9 @@ static std::vector<perf_result> test_read(cql_test_env& env, test_config& cfg, s
         query += ", \"CC\"";
     }
     query += " from cf where \"KEY\" = ?";
+    if (cfg.query_clustering_key) {
+        query += " and \"CK\" = ?";
+    }
     if (cfg.bypass_cache) {
         query += " bypass cache";
     }
@@ -213,14 +262,65 @@ static std::vector<perf_result> test_read(cql_test_env& env, test_config& cfg, s
         query += " using timeout " + cfg.timeout;
     }
     auto id = env.prepare(query).get();
-    return time_parallel([&env, &cfg, &shard_seqs, id] {
+    auto results = time_parallel([&env, &cfg, &shard_seqs, id] {
             auto key = next_key(cfg, shard_seqs.local());
             if (!key) {
                 // This shard owns no partitions in shard-aware mode; idle for
                 // one measurement window instead of issuing a cross-shard query.
                 return seastar::sleep(std::chrono::seconds(1));
             }
-            return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(*key))}}, cfg.consistency_level).discard_result();
+            std::vector<cql3::raw_value> values{cql3::raw_value::make_value(std::move(*key))};
+            if (cfg.query_clustering_key) {
+                values.push_back(cql3::raw_value::make_value(int32_type->decompose(int32_t(0))));
+            }
+            return env.execute_prepared(id, std::move(values), cfg.consistency_level).discard_result();
+        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
+    if (cfg.coordinator_read_cache) {
+        print_coordinator_read_cache_stats(env);
+    }
+    return results;
+}
+
+// Fills the aggregate mode table with partitions of rows_per_partition rows.
+static void create_aggregate_rows(cql_test_env& env, test_config& cfg) {
+    std::cout << "Creating " << cfg.partitions << " partitions of " << cfg.rows_per_partition << " rows..." << std::endl;
+    auto id = env.prepare("INSERT INTO cf (\"KEY\", \"CK\", \"N\", \"D\") VALUES (?, ?, ?, ?)").get();
+    unsigned next_flush = (cfg.memtable_partitions > 0 ? cfg.memtable_partitions : cfg.partitions);
+    for (unsigned sequence = 0; sequence < cfg.partitions; ++sequence) {
+        parallel_for_each(std::views::iota(0u, cfg.rows_per_partition), [&env, id, sequence] (unsigned row) {
+            auto n = int64_t(sequence) * 1000 + row;
+            return env.execute_prepared(id, {
+                    cql3::raw_value::make_value(make_key(sequence)),
+                    cql3::raw_value::make_value(int32_type->decompose(int32_t(row))),
+                    cql3::raw_value::make_value(long_type->decompose(n)),
+                    cql3::raw_value::make_value(double_type->decompose(double(n) / 7))}, db::consistency_level::QUORUM).discard_result();
+        }).get();
+        if (sequence + 1 >= next_flush) {
+            env.db().invoke_on_all(&replica::database::flush_all_memtables).get();
+            next_flush += cfg.memtable_partitions;
+        }
+    }
+
+    if (cfg.flush_memtables) {
+        std::cout << "Flushing partitions..." << std::endl;
+        env.db().invoke_on_all(&replica::database::flush_all_memtables).get();
+    }
+}
+
+// Each operation aggregates all rows of the table, exercising the batched
+// aggregation of fixed-width numeric columns.
+static std::vector<perf_result> test_aggregate(cql_test_env& env, test_config& cfg) {
+    create_aggregate_rows(env, cfg);
+    sstring query = "select count(*), sum(\"N\"), min(\"N\"), max(\"N\"), avg(\"D\") from cf";
+    if (cfg.bypass_cache) {
+        query += " bypass cache";
+    }
+    if (!cfg.timeout.empty()) {
+        query += " using timeout " + cfg.timeout;
+    }
+    auto id = env.prepare(query).get();
+    return time_parallel([&env, &cfg, id] {
+            return env.execute_prepared(id, {}, cfg.consistency_level).discard_result();
         }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
 }
 
@@ -239,16 +339,26 @@ static std::vector<perf_result> test_write(cql_test_env& env, test_config& cfg,
             "\"C2\" = 0x583449ce81bfebc2e1a695eb59aad5fcc74d6d7311fc6197b10693e1a161ca2e1c64,"
             "\"C3\" = 0x62bcb1dbc0ff953abc703bcb63ea954f437064c0c45366799658bd6b91d0f92908d7,"
             "\"C4\" = 0x222fcbe31ffa1e689540e1499b87fa3f9c781065fccd10e4772b4c7039c2efd0fb27{} "
-            "WHERE \"KEY\" = ?", usings, col_suffix);
+            "WHERE \"KEY\" = ?", cfg.batch_size > 0 ? "" : usings, col_suffix);
+    if (cfg.batch_size > 0) {
+        // The timeout applies to the whole batch, not to its statements.
+        query = format("BEGIN UNLOGGED BATCH {} {}; APPLY BATCH",
+                usings, fmt::join(std::vector<sstring>(cfg.batch_size, query), "; "));
+    }
     auto id = env.prepare(query).get();
     return time_parallel([&env, &cfg, &shard_seqs, id] {
-            auto key = next_key(cfg, shard_seqs.local());
-            if (!key) {
-                // This shard owns no partitions in shard-aware mode; idle for
-                // one measurement window instead of issuing a cross-shard query.
-                return seastar::sleep(std::chrono::seconds(1));
+            std::vector<cql3::raw_value> values;
+            values.reserve(std::max(cfg.batch_size, 1u));
+            for (unsigned i = 0; i < std::max(cfg.batch_size, 1u); ++i) {
+                auto key = next_key(cfg, shard_seqs.local());
+                if (!key) {
+                    // This shard owns no partitions in shard-aware mode; idle for
+                    // one measurement window instead of issuing a cross-shard query.
+                    return seastar::sleep(std::chrono::seconds(1));
+                }
+                values.push_back(cql3::raw_value::make_value(std::move(*key)));
             }
-            return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(*key))}}, cfg.consistency_level).discard_result();
+            return env.execute_prepared(id, std::move(values), cfg.consistency_level).discard_result();
         }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
 }
 
@@ -316,6 +426,14 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
         if (cfg.counters) {
             return *make_counter_schema(ks_name);
         }
+        if (cfg.mode == test_config::run_mode::aggregate) {
+            return *schema_builder(this_smp_shard_count(), ks_name, "cf")
+                    .with_column("KEY", bytes_type, column_kind::partition_key)
+                    .with_column("CK", int32_type, column_kind::clustering_key)
+                    .with_column("N", long_type)
+                    .with_column("D", double_type)
+                    .build();
+        }
         auto sb = schema_builder(this_smp_shard_count(), ks_name, "cf")
                 .with_column("KEY", bytes_type, column_kind::partition_key)
                 .with_column("C0", bytes_type)
@@ -326,6 +444,12 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
         if (cfg.collection > 0) {
             sb.with_column("CC", map_type_impl::get_instance(bytes_type, bytes_type, true));
         }
+        if (cfg.query_clustering_key) {
+            sb.with_column("CK", int32_type, column_kind::clustering_key);
+        }
+        if (cfg.coordinator_read_cache) {
+            sb.set_caching_options(caching_options::from_map({{"coordinator", "true"}}));
+        }
         return *sb.build();
     }).get();
 
@@ -358,6 +482,8 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
         }
     case test_config::run_mode::del:
         return test_delete(env, cfg, shard_seqs);
+    case test_config::run_mode::aggregate:
+        return test_aggregate(env, cfg);
     };
     abort();
 }
@@ -375,12 +501,22 @@ void write_json_result(std::string result_file, const test_config& cfg, const ag
     if (cfg.collection > 0) {
         params["collection"] = cfg.collection;
     }
+    if (cfg.batch_size > 0) {
+        params["batch_size"] = cfg.batch_size;
+    }
+    if (cfg.mode == test_config::run_mode::aggregate) {
+        params["rows_per_partition"] = cfg.rows_per_partition;
+    }
+    if (cfg.query_clustering_key) {
+        params["query_clustering_key"] = true;
+    }
 
     std::string test_type;
     switch (cfg.mode) {
     case test_config::run_mode::read: test_type = "read"; break;
     case test_config::run_mode::write: test_type = "write"; break;
     case test_config::run_mode::del: test_type = "delete"; break;
+    case test_config::run_mode::aggregate: test_type = "aggregate"; break;
     }
     if (cfg.counters) {
         test_type += "_counters";
@@ -408,11 +544,16 @@ int scylla_simple_query_main(int argc, char** argv) {
         ("partitions", bpo::value<unsigned>()->default_value(10000), "number of partitions")
         ("write", "test write path instead of read path")
         ("delete", "test delete path instead of read path")
+        ("aggregate", "test aggregation of all rows of the table instead of the read path (combine with a low --concurrency)")
+        ("rows-per-partition", bpo::value<unsigned>()->default_value(100), "number of rows of each partition in aggregate mode")
         ("duration", bpo::value<unsigned>()->default_value(5), "test duration in seconds")
         ("query-single-key", "test reading with a single key instead of random keys")
+        ("query-clustering-key", "test reading a row by partition and clustering key, from a table with a clustering key (read mode only, excludes --counters)")
         ("concurrency", bpo::value<unsigned>()->default_value(100), "workers per core")
         ("operations-per-shard", bpo::value<unsigned>(), "run this many operations per shard (overrides duration)")
         ("counters", "test counters")
+        ("batch-size", bpo::value<unsigned>()->default_value(0), "number of partitions written by each UNLOGGED BATCH in write mode (0 writes single partitions, excludes --counters)")
+        ("memtable-write-batching", "apply small writes arriving together to memtables in batches")
         ("collection", bpo::value<unsigned>()->default_value(0), "add map<text,text> collection column with N cells per row (excludes --counters)")
         ("tablets", "use tablets")
         ("strongly-consistent-tables", "use strongly consistent tables")
@@ -428,6 +569,8 @@ int scylla_simple_query_main(int argc, char** argv) {
         ("stop-on-error", bpo::value<bool>()->default_value(true), "stop after encountering the first error")
         ("timeout", bpo::value<std::string>()->default_value(""), "use timeout")
         ("bypass-cache", "use bypass cache when querying")
+        ("coordinator-read-cache", "serve reads of hot partitions from the coordinator read cache (combine with --query-single-key --shard-aware 0 --consistency-level ONE)")
+        ("coordinator-read-cache-ttl", bpo::value<unsigned>()->default_value(100), "coordinator read cache TTL in milliseconds")
         ("shard-aware", bpo::value<bool>()->default_value(true), "generate keys owned by the shard issuing the query (use --shard-aware 0 to disable)")
         ("audit", bpo::value<std::string>(), "value for audit config entry")
         ("audit-keyspaces", bpo::value<std::string>(), "value for audit_keyspaces config entry")
@@ -464,6 +607,9 @@ int scylla_simple_query_main(int argc, char** argv) {
                 db_cfg->sstable_format(app.configuration()["sstable-format"].as<std::string>());
             }
             std::cout << "sstable-format=" << db_cfg->sstable_format() << '\n';
+            db_cfg->coordinator_read_cache_ttl_in_ms(app.configuration()["coordinator-read-cache-ttl"].as<unsigned>());
+            db_cfg->memtable_write_batching(app.configuration().contains("memtable-write-batching"));
+            std::cout << "memtable-write-batching=" << db_cfg->memtable_write_batching() << '\n';
             cql_test_config cfg(db_cfg);
             if (app.configuration().contains("tablets")) {
                 cfg.db_config->tablets_mode_for_new_keyspaces.set(db::tablets_mode_t::mode::enabled);
@@ -494,6 +640,10 @@ int scylla_simple_query_main(int argc, char** argv) {
             if (cfg.counters && cfg.collection > 0) {
                 throw std::invalid_argument("--collection and --counters are mutually exclusive");
             }
+            cfg.batch_size = app.configuration()["batch-size"].as<unsigned>();
+            if (cfg.counters && cfg.batch_size > 0) {
+                throw std::invalid_argument("--batch-size and --counters are mutually exclusive");
+            }
             if (app.configuration().contains("tablets")) {
                 cfg.initial_tablets = app.configuration()["initial-tablets"].as<unsigned>();
             }
@@ -501,9 +651,19 @@ int scylla_simple_query_main(int argc, char** argv) {
                 cfg.mode = test_config::run_mode::write;
             } else if (app.configuration().contains("delete")) {
                 cfg.mode = test_config::run_mode::del;
+            } else if (app.configuration().contains("aggregate")) {
+                cfg.mode = test_config::run_mode::aggregate;
+                cfg.rows_per_partition = app.configuration()["rows-per-partition"].as<unsigned>();
+                if (cfg.counters || cfg.collection > 0 || cfg.batch_size > 0) {
+                    throw std::invalid_argument("--aggregate excludes --counters, --collection and --batch-size");
+                }
             } else {
                 cfg.mode = test_config::run_mode::read;
             };
+            cfg.query_clustering_key = app.configuration().contains("query-clustering-key");
+            if (cfg.query_clustering_key && (cfg.mode != test_config::run_mode::read || cfg.counters)) {
+                throw std::invalid_argument("--query-clustering-key works only in read mode, without --counters");
+            }
             if (app.configuration().contains("operations-per-shard")) {
                 cfg.operations_per_shard = app.configuration()["operations-per-shard"].as<unsigned>();
             }
@@ -514,6 +674,7 @@ int scylla_simple_query_main(int argc, char** argv) {
             cfg.timeout = app.configuration()["timeout"].as<std::string>();
             cfg.bypass_cache = app.configuration().contains("bypass-cache");
             cfg.shard_aware = app.configuration()["shard-aware"].as<bool>();
+            cfg.coordinator_read_cache = app.configuration().contains("coordinator-read-cache");
             cfg.consistency_level = db::consistency_level_from_string(app.configuration()["consistency-level"].as<std::string>());
             audit::audit::start_audit(env.local_db().get_config(), env.get_shared_token_metadata(), env.qp(), env.migration_manager()).handle_exception([&] (auto&& e) {
                 fmt::print("audit start failed: {}", e);
@@ -48,6 +48,10 @@ future<> test_sequential_read(sharded<perf_sstable_test_env>& dt) {
     return time_runs(iterations, parallelism, dt, &perf_sstable_test_env::read_sequential_partitions);
 }
 
+future<> test_projected_read(sharded<perf_sstable_test_env>& dt) {
+    return time_runs(iterations, parallelism, dt, &perf_sstable_test_env::read_projected_partitions);
+}
+
 future<> test_full_scan_streaming(sharded<perf_sstable_test_env>& dt) {
     return time_runs(iterations, parallelism, dt, &perf_sstable_test_env::full_scan_streaming);
 }
@@ -58,6 +62,7 @@ future<> test_partitioned_streaming(sharded<perf_sstable_test_env>& dt) {
 
 enum class test_modes {
     sequential_read,
+    projected_read,
     index_read,
     write,
     index_write,
@@ -68,6 +73,7 @@ enum class test_modes {
 
 static const std::unordered_map<sstring, test_modes> test_mode = {
     {"sequential_read", test_modes::sequential_read },
+    {"projected_read", test_modes::projected_read },
     {"index_read", test_modes::index_read },
     {"write", test_modes::write },
     {"index_write", test_modes::index_write },
@@ -109,8 +115,9 @@ int scylla_sstable_main(int argc, char** argv) {
         ("key_size", bpo::value<unsigned>()->default_value(128), "size of partition key")
         ("num_columns", bpo::value<unsigned>()->default_value(5), "number of columns per row")
         ("column_size", bpo::value<unsigned>()->default_value(64), "size in bytes for each column")
+        ("projected_columns", bpo::value<unsigned>()->default_value(1), "number of columns selected by the read (valid only for projected_read mode)")
         ("sstables", bpo::value<unsigned>()->default_value(1), "number of sstables (valid only for compaction mode)")
-        ("mode", bpo::value<test_modes>()->default_value(test_modes::index_write), "one of: sequential_read, index_read, write, compaction, index_write, full_scan_streaming, partitioned_streaming")
+        ("mode", bpo::value<test_modes>()->default_value(test_modes::index_write), "one of: sequential_read, projected_read, index_read, write, compaction, index_write, full_scan_streaming, partitioned_streaming")
         ("testdir", bpo::value<sstring>()->default_value("/var/lib/scylla/perf-tests"), "directory in which to store the sstables")
         ("compaction-strategy", bpo::value<sstring>()->default_value("SizeTieredCompactionStrategy"), "compaction strategy to use, one of "
              "(SizeTieredCompactionStrategy, LeveledCompactionStrategy, DateTieredCompactionStrategy, TimeWindowCompactionStrategy)")
@@ -137,6 +144,7 @@ int scylla_sstable_main(int argc, char** argv) {
                 cfg.num_columns = app.configuration()["num_columns"].as<unsigned>();
                 cfg.column_size = app.configuration()["column_size"].as<unsigned>();
             }
+            cfg.projected_columns = app.configuration()["projected_columns"].as<unsigned>();
             cfg.compaction_strategy = compaction::compaction_strategy::type(app.configuration()["compaction-strategy"].as<sstring>());
             cfg.timestamp_range = app.configuration()["timestamp-range"].as<api::timestamp_type>();
             auto scf = make_sstable_compressor_factory_for_tests_in_thread();
@@ -149,6 +157,8 @@ int scylla_sstable_main(int argc, char** argv) {
                 [[fallthrough]];
             case sequential_read:
                 [[fallthrough]];
+            case projected_read:
+                [[fallthrough]];
             case full_scan_streaming:
                 [[fallthrough]];
             case partitioned_streaming:
@@ -178,6 +188,9 @@ int scylla_sstable_main(int argc, char** argv) {
             case sequential_read:
                 test_sequential_read(test).get();
                 break;
+            case projected_read:
+                test_projected_read(test).get();
+                break;
             case full_scan_streaming:
                 test_full_scan_streaming(test).get();
                 break;
@@ -94,6 +94,7 @@ class perf_sstable_test_env {
         unsigned key_size;
         unsigned num_columns;
         unsigned column_size;
+        unsigned projected_columns;
         unsigned sstables;
         size_t buffer_size;
         sstring dir;
@@ -318,8 +319,8 @@ class perf_sstable_test_env {
         });
     }
 
-    future<double> read_sequential_partitions(int idx) {
-        return with_closeable(_sst[0]->make_reader(s, _env.make_reader_permit(), query::full_partition_range, s->full_slice()), [this] (auto& r) {
+    future<double> read_partitions(const query::partition_slice& slice) {
+        return with_closeable(_sst[0]->make_reader(s, _env.make_reader_permit(), query::full_partition_range, slice), [this] (auto& r) {
             auto start = perf_sstable_test_env::now();
             auto total = make_lw_shared<size_t>(0);
             auto done = make_lw_shared<bool>(false);
@@ -344,6 +345,21 @@ class perf_sstable_test_env {
         });
     }
 
+    future<double> read_sequential_partitions(int idx) {
+        return read_partitions(s->full_slice());
+    }
+
+    // Like read_sequential_partitions(), but selects only the first
+    // projected_columns columns, letting the reader skip the other values.
+    future<double> read_projected_partitions(int idx) {
+        auto slice = s->full_slice();
+        slice.regular_columns.resize(std::min<size_t>(_cfg.projected_columns, slice.regular_columns.size()));
+        slice.set_allow_column_projection(true);
+        return do_with(std::move(slice), [this] (const query::partition_slice& slice) {
+            return read_partitions(slice);
+        });
+    }
+
     future<double> full_scan_streaming(int idx) {
         return do_streaming(sst_reader::full_scan);
     }
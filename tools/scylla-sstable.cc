@@ -771,6 +771,7 @@ class scylla_sstable_compaction_group_view : public compaction::compaction_group
     compaction::compaction_backlog_tracker _backlog_tracker;
     std::string _group_id;
     condition_variable _staging_done_condition;
+    utils::estimated_histogram _sstables_per_read{35};
     mutable sstable_generation_generator _generation_generator;
 
 private:
@@ -834,6 +835,7 @@ class scylla_sstable_compaction_group_view : public compaction::compaction_group
     virtual seastar::condition_variable& get_staging_done_condition() noexcept override { return _staging_done_condition; }
     dht::token_range get_token_range_after_split(const dht::token& t) const noexcept override { return dht::token_range(); }
     int64_t get_sstables_repaired_at() const noexcept override { return 0; }
+    const utils::estimated_histogram& sstables_per_read_histogram() const noexcept override { return _sstables_per_read; }
 };
 
 void validate_output_dir(std::filesystem::path output_dir) {
@@ -101,6 +101,9 @@ class result_message::bounce : public result_message {
     std::optional<seastar::lowres_clock::time_point> _timeout;
     std::optional<bool> _is_write;
     locator::host_id_or_exception_callback _on_forwarding_finished;
+    // Set when a read is moved to the shard owning its data,
+    // see cql_migrate_single_partition_reads.
+    bool _read_migration = false;
 
 public:
     bounce(locator::host_id host, unsigned shard, cql3::computed_function_values cached_fn_calls,
@@ -143,6 +146,14 @@ class result_message::bounce : public result_message {
     const locator::host_id_or_exception_callback& on_forwarding_finished() const {
         return _on_forwarding_finished;
     }
+
+    void set_read_migration() {
+        _read_migration = true;
+    }
+
+    bool is_read_migration() const {
+        return _read_migration;
+    }
 };
 
 std::ostream& operator<<(std::ostream& os, const result_message::bounce& msg);
@@ -368,6 +368,13 @@ cql_server::cql_server(sharded<cql3::query_processor>& qp, auth::service& auth_s
         sm::make_counter("requests_shed", _stats.requests_shed,
                         sm::description("Holds an incrementing counter with the requests that were shed due to overload (threshold configured via max_concurrent_requests_per_shard). "
                                             "The first derivative of this value shows how often we shed requests due to overload in the \"CQL transport\" component."))(basic_level),
+        sm::make_counter("requests_migrated", _stats.requests_migrated,
+                        sm::description("Counts the number of single-partition reads which were moved to another shard of this node for processing, "
+                                            "because that shard owns the data (see cql_migrate_single_partition_reads). Other shard bounces, e.g. of LWT requests, are not counted. "
+                                            "Compare with requests_served to get the fraction of migrated requests.")),
+        sm::make_counter("requests_migrated_bytes", _stats.requests_migrated_bytes,
+                        sm::description("Counts the bytes of the reads counted by requests_migrated. "
+                                            "The request buffer is read in place by the target shard, it is not copied.")),
         sm::make_counter("connections_shed", _shed_connections,
             sm::description("Holds an incrementing counter with the CQL connections that were shed due to concurrency semaphore timeout (threshold configured via uninitialized_connections_semaphore_cpu_concurrency). "
                                             "This typically can happen during connection storm. ")),
@@ -2001,6 +2008,10 @@ cql_server::process(uint16_t stream, request_reader in, service::client_state& c
         auto my_host_id = _query_processor.local().proxy().get_token_metadata_ptr()->get_topology().my_host_id();
         if (target_host == my_host_id) {
             // Shard bounce
+            if ((*bounce_msg)->is_read_migration()) {
+                ++_stats.requests_migrated;
+                _stats.requests_migrated_bytes += is.bytes_left();
+            }
             auto sg = _config.bounce_request_smp_service_group;
             auto gcs = client_state.move_to_other_shard();
             auto gt = tracing::global_trace_state_ptr(trace_state);
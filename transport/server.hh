@@ -221,6 +221,9 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         uint32_t requests_serving = 0;
         uint64_t requests_blocked_memory = 0;
         uint64_t requests_shed = 0;
+        // requests whose processing moved to another shard of this node
+        uint64_t requests_migrated = 0;
+        uint64_t requests_migrated_bytes = 0;
         // forwarding stats
         uint64_t requests_forwarded_successfully = 0;
         uint64_t requests_forwarded_failed = 0;
@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <limits>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 namespace utils {
 
@@ -29,6 +33,29 @@ static constexpr int64_t simple_key_unused_value = std::numeric_limits<int64_t>:
  */
 int array_search_gt(int64_t val, const int64_t* array, const int capacity, const int size);
 
+/*
+ * Same as above, for arrays of a compile-time capacity. When the target
+ * architecture has AVX2 (e.g. -march=x86-64-v3) the search is inlined into
+ * the caller, with the loop over the capacity fully unrolled, which spares
+ * the out-of-line call and the runtime dispatch on every tree node visited.
+ */
+template <int Capacity>
+inline int array_search_gt(int64_t val, const int64_t* array, const int size) {
+    static_assert(Capacity % 4 == 0);
+#ifdef __AVX2__
+    int cnt = 0;
+    __m256i k = _mm256_set1_epi64x(val);
+    for (int i = 0; i < Capacity; i += 4) {
+        auto gt = _mm256_cmpgt_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&array[i])), k);
+        cnt += std::popcount(unsigned(_mm256_movemask_pd(_mm256_castsi256_pd(gt))));
+    }
+    // Unused elements are less than any key, see the out-of-line version
+    return size - cnt;
+#else
+    return array_search_gt(val, array, Capacity, size);
+#endif
+}
+
 inline unsigned array_search_4_eq(uint8_t val, const uint8_t* array) {
     // Unrolled loop is few %s faster
     if (array[0] == val) {
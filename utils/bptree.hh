@@ -896,7 +896,7 @@ requires SimpleLessCompare<K, Less>
 struct searcher<K, int64_t, Less, Size, key_search::linear> {
     static_assert(sizeof(maybe_key<int64_t, Less>) == sizeof(int64_t));
     static size_t gt(const K& k, const maybe_key<int64_t, Less>* keys, size_t nr, Less less) noexcept {
-        return utils::array_search_gt(less.simplify_key(k), reinterpret_cast<const int64_t*>(keys), Size, nr);
+        return utils::array_search_gt<Size>(less.simplify_key(k), reinterpret_cast<const int64_t*>(keys), nr);
     }
 };
 
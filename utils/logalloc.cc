@@ -399,6 +399,14 @@ static thread_local tracker& tracker_instance = get_tracker_instance();
 
 using clock = std::chrono::steady_clock;
 
+static bool below_background_reclaim_threshold() noexcept {
+#ifndef SEASTAR_DEFAULT_ALLOCATOR
+    return memory::free_memory() < background_reclaim_free_memory_threshold;
+#else
+    return false;
+#endif
+}
+
 class background_reclaimer {
     scheduling_group _sg;
     noncopyable_function<void (size_t target)> _reclaim;
@@ -410,11 +418,7 @@ class background_reclaimer {
     static constexpr size_t free_memory_threshold = background_reclaim_free_memory_threshold;
 private:
     bool have_work() const {
-#ifndef SEASTAR_DEFAULT_ALLOCATOR
-        return memory::free_memory() < free_memory_threshold;
-#else
-        return false;
-#endif
+        return below_background_reclaim_threshold();
     }
     void main_loop_wake() {
         llogger.debug("background_reclaimer::main_loop_wake: waking {}", bool(_main_loop_wait));
@@ -487,6 +491,8 @@ class tracker::impl {
     seastar::metrics::metric_groups _metrics;
     unsigned _reclaiming_disabled_depth = 0;
     size_t _reclamation_step = 1;
+    bool _defragment_on_idle = false;
+    size_t _idle_free_segments = 0;
     bool _abort_on_bad_alloc = false;
     bool _sanitizer_report_backtrace = false;
     reclaim_timer* _active_timer = nullptr;
@@ -533,8 +539,12 @@ class tracker::impl {
     void unregister_region(region::impl*) noexcept;
     size_t reclaim(size_t bytes, is_preemptible p);
     // Compacts one segment at a time from sparsest segment to least sparse until work_waiting_on_reactor returns true
-    // or there are no more segments to compact.
-    idle_cpu_handler_result compact_on_idle(work_waiting_on_reactor check_for_work);
+    // or there are no more segments to compact. Unless defragmenting on idle, stops as soon as the pool
+    // holds the configured number of free segments, and does nothing while free memory is plentiful.
+    idle_cpu_handler_result compact_on_idle(work_waiting_on_reactor check_for_work) {
+        return compact_on_idle(_defragment_on_idle, _idle_free_segments, check_for_work);
+    }
+    idle_cpu_handler_result compact_on_idle(bool defragment, size_t free_segments, work_waiting_on_reactor check_for_work);
     // Releases whole segments back to the segment pool.
     // After the call, if there is enough evictable memory, the amount of free segments in the pool
     // will be at least reserve_segments + div_ceil(bytes, segment::size).
@@ -549,6 +559,10 @@ class tracker::impl {
     // Set the minimum number of segments reclaimed during single reclamation cycle.
     void set_reclamation_step(size_t step_in_segments) noexcept { _reclamation_step = step_in_segments; }
     size_t reclamation_step() const noexcept { return _reclamation_step; }
+    void set_idle_compaction(bool defragment, size_t free_segments) noexcept {
+        _defragment_on_idle = defragment;
+        _idle_free_segments = free_segments;
+    }
     // Abort on allocation failure from LSA
     void enable_abort_on_bad_alloc() noexcept { _abort_on_bad_alloc = true; }
     bool should_abort_on_bad_alloc() const noexcept { return _abort_on_bad_alloc; }
@@ -607,6 +621,10 @@ size_t tracker::reclaim(size_t bytes) {
     return _impl->reclaim(bytes, is_preemptible::no);
 }
 
+idle_cpu_handler_result tracker::compact_on_idle(size_t free_segments, work_waiting_on_reactor check_for_work) {
+    return _impl->compact_on_idle(false, free_segments, check_for_work);
+}
+
 occupancy_stats tracker::global_occupancy() const noexcept {
     return _impl->global_occupancy();
 }
@@ -1132,6 +1150,8 @@ class segment_pool {
     inline void on_memory_allocation(size_t size) noexcept;
     inline void on_memory_deallocation(size_t size) noexcept;
     inline void on_memory_eviction(size_t size) noexcept;
+    inline void on_foreground_reclaim() noexcept;
+    inline void on_idle_compaction() noexcept;
     size_t unreserved_free_segments() const noexcept { return _free_segments - std::min(_free_segments, _emergency_reserve_max); }
     size_t free_segments() const noexcept { return _free_segments; }
 };
@@ -1472,6 +1492,14 @@ inline void segment_pool::on_memory_eviction(size_t size) noexcept {
     _stats.memory_evicted += size;
 }
 
+inline void segment_pool::on_foreground_reclaim() noexcept {
+    ++_stats.foreground_reclaims;
+}
+
+inline void segment_pool::on_idle_compaction() noexcept {
+    ++_stats.idle_segments_compacted;
+}
+
 // RAII wrapper to maintain segment_pool::current_emergency_reserve_goal()
 class segment_pool::reservation_goal {
     segment_pool& _sp;
@@ -2388,7 +2416,8 @@ bool tracker::should_abort_on_bad_alloc() const noexcept {
 }
 
 void tracker::configure(const config& cfg) {
-    if (cfg.defragment_on_idle) {
+    if (cfg.defragment_on_idle || cfg.idle_free_segments) {
+        _impl->set_idle_compaction(cfg.defragment_on_idle, cfg.idle_free_segments);
         engine().set_idle_cpu_handler([this] (reactor::work_waiting_on_reactor check_for_work) {
             return _impl->compact_on_idle(check_for_work);
         });
@@ -2621,10 +2650,21 @@ static void reclaim_from_evictable(region::impl& r, size_t target_mem_in_use, is
     }
 }
 
-idle_cpu_handler_result tracker::impl::compact_on_idle(work_waiting_on_reactor check_for_work) {
+idle_cpu_handler_result tracker::impl::compact_on_idle(bool defragment, size_t free_segments, work_waiting_on_reactor check_for_work) {
     if (_reclaiming_disabled_depth) {
         return idle_cpu_handler_result::no_more_work;
     }
+    // Unless asked to defragment everything, only prepare enough free segments
+    // for allocations to be served without compacting synchronously. The
+    // background reclaimer hands them over to the standard allocator when it
+    // needs memory, so this is only done while memory is short.
+    auto reserve_ready = [this, defragment, free_segments] {
+        return !defragment
+            && (!below_background_reclaim_threshold() || _segment_pool->unreserved_free_segments() >= free_segments);
+    };
+    if (reserve_ready()) {
+        return idle_cpu_handler_result::no_more_work;
+    }
     reclaiming_lock rl(*this);
     if (_regions.empty()) {
         return idle_cpu_handler_result::no_more_work;
@@ -2649,8 +2689,13 @@ idle_cpu_handler_result tracker::impl::compact_on_idle(work_waiting_on_reactor c
         }
 
         r->compact();
+        _segment_pool->on_idle_compaction();
 
         std::ranges::push_heap(_regions, cmp);
+
+        if (reserve_ready()) {
+            return idle_cpu_handler_result::no_more_work;
+        }
     }
     return idle_cpu_handler_result::interrupted_by_higher_priority_task;
 }
@@ -2660,6 +2705,9 @@ size_t tracker::impl::reclaim(size_t memory_to_release, is_preemptible preempt)
         return 0;
     }
     reclaiming_lock rl(*this);
+    if (!preempt) {
+        _segment_pool->on_foreground_reclaim();
+    }
     reclaim_timer timing_guard("reclaim", _stats.reclaim_time, preempt, memory_to_release, 0, *this);
     return timing_guard.set_memory_released(reclaim_locked(memory_to_release, preempt));
 }
@@ -2703,6 +2751,9 @@ size_t tracker::impl::compact_and_evict(size_t reserve_segments, size_t memory_t
         return 0;
     }
     reclaiming_lock rl(*this);
+    if (!preempt) {
+        _segment_pool->on_foreground_reclaim();
+    }
     return compact_and_evict_locked(reserve_segments, memory_to_release, preempt);
 }
 
@@ -2884,6 +2935,12 @@ tracker::impl::impl() : _segment_pool(std::make_unique<logalloc::segment_pool>(*
         sm::make_counter("memory_freed", [this] { return _segment_pool->statistics().memory_freed; },
                         sm::description("Counts number of bytes which were requested to be freed in LSA.")),
 
+        sm::make_counter("foreground_reclaims", [this] { return _segment_pool->statistics().foreground_reclaims; },
+                        sm::description("Counts reclamations which ran synchronously with an allocation, stalling it.")),
+
+        sm::make_counter("idle_segments_compacted", [this] { return _segment_pool->statistics().idle_segments_compacted; },
+                        sm::description("Counts a number of segments compacted while the cpu was idle.")),
+
         sm::make_counter("reclaim_time_ms", [this] { return count_millis(_stats.reclaim_time); },
                         sm::description("Total time spent in reclaiming LSA memory back to std allocator.")),
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <seastar/core/idle_cpu_handler.hh>
 #include <seastar/core/memory.hh>
 #include <seastar/core/shard_id.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -64,6 +65,10 @@ class tracker {
         bool abort_on_lsa_bad_alloc;
         bool sanitizer_report_backtrace = false; // Better reports but slower
         size_t lsa_reclamation_step;
+        // Number of free segments which idle-time compaction keeps in the pool
+        // while free memory is below background_reclaim_free_memory_threshold.
+        // Ignored when defragment_on_idle is set.
+        size_t idle_free_segments = 0;
         scheduling_group background_reclaim_sched_group;
         std::chrono::nanoseconds background_reclaim_shares_adjust_period = std::chrono::milliseconds(50);
     };
@@ -76,6 +81,9 @@ class tracker {
         uint64_t memory_compacted;
         uint64_t memory_evicted;
         uint64_t num_allocations;
+        // Reclamations run synchronously with an allocation.
+        uint64_t foreground_reclaims;
+        uint64_t idle_segments_compacted;
 
         friend stats operator+(const stats& s1, const stats& s2) {
             stats result(s1);
@@ -95,6 +103,8 @@ class tracker {
             memory_compacted += other.memory_compacted;
             memory_evicted += other.memory_evicted;
             num_allocations += other.num_allocations;
+            foreground_reclaims += other.foreground_reclaims;
+            idle_segments_compacted += other.idle_segments_compacted;
             return *this;
         }
         stats& operator-=(const stats& other) {
@@ -105,6 +115,8 @@ class tracker {
             memory_compacted -= other.memory_compacted;
             memory_evicted -= other.memory_evicted;
             num_allocations -= other.num_allocations;
+            foreground_reclaims -= other.foreground_reclaims;
+            idle_segments_compacted -= other.idle_segments_compacted;
             return *this;
         }
     };
@@ -135,6 +147,11 @@ class tracker {
     //
     size_t reclaim(size_t bytes);
 
+    // Compacts the sparsest segments, as done while the cpu is idle, until
+    // check_for_work returns true or the pool holds free_segments free
+    // segments. Does nothing while free memory is plentiful. Mainly for testing.
+    idle_cpu_handler_result compact_on_idle(size_t free_segments, work_waiting_on_reactor check_for_work);
+
     // Compacts as much as possible. Very expensive, mainly for testing.
     // Guarantees that every live object from reclaimable regions will be moved.
     // Invalidates references to objects in all compactible and evictable regions.